@@ -59,6 +59,7 @@ struct TRITONBACKEND_Input;
 struct TRITONBACKEND_Output;
 struct TRITONBACKEND_Request;
 struct TRITONBACKEND_ResponseFactory;
+struct TRITONBACKEND_State;
 struct TRITONBACKEND_Response;
 struct TRITONBACKEND_Backend;
 struct TRITONBACKEND_Model;
@@ -90,7 +91,7 @@ struct TRITONBACKEND_ModelInstance;
 ///   }
 ///
 #define TRITONBACKEND_API_VERSION_MAJOR 1
-#define TRITONBACKEND_API_VERSION_MINOR 2
+#define TRITONBACKEND_API_VERSION_MINOR 12
 
 /// Get the TRITONBACKEND API version supported by Triton. This value
 /// can be compared against the TRITONBACKEND_API_VERSION_MAJOR and
@@ -172,6 +173,78 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_MemoryManagerFree(
     TRITONBACKEND_MemoryManager* manager, void* buffer,
     const TRITONSERVER_MemoryType memory_type, const int64_t memory_type_id);
 
+/// Allocate a contiguous block of memory ordered with respect to a
+/// CUDA stream. The allocation is performed from a stream-ordered
+/// pool sized by TRITONSERVER_ServerOptionsSetCudaMemoryPoolByteSize
+/// and does not synchronize with in-flight kernels or take a
+/// device-wide lock: the returned buffer may be used by work
+/// subsequently enqueued on 'cuda_stream' without further
+/// synchronization, but must not be accessed from another stream
+/// until the allocating stream is synchronized. Only
+/// TRITONSERVER_MEMORY_GPU is supported; for other memory types an
+/// error with code TRITONSERVER_ERROR_UNSUPPORTED is returned. The
+/// error codes described for TRITONBACKEND_MemoryManagerAllocate
+/// apply.
+///
+/// \param manager The memory manager.
+/// \param buffer Returns the allocated memory.
+/// \param memory_type_id The ID of the GPU to allocate from.
+/// \param byte_size The size of memory to allocate, in bytes.
+/// \param cuda_stream The CUDA stream (cudaStream_t cast to void*)
+/// that orders the allocation.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_MemoryManagerAllocateAsync(
+    TRITONBACKEND_MemoryManager* manager, void** buffer,
+    const int64_t memory_type_id, const uint64_t byte_size, void* cuda_stream);
+
+/// Free a buffer that was previously allocated with
+/// TRITONBACKEND_MemoryManagerAllocateAsync. The free is ordered with
+/// respect to 'cuda_stream': the buffer is returned to the pool once
+/// all work enqueued on the stream before this call has completed,
+/// and may be handed out again to a later stream-ordered allocation
+/// without a device synchronization. The call must provide the same
+/// value for 'memory_type_id' as was used when the buffer was
+/// allocated or else the behavior is undefined.
+///
+/// \param manager The memory manager.
+/// \param buffer The allocated memory buffer to free.
+/// \param memory_type_id The ID of the GPU the buffer was allocated
+/// from.
+/// \param cuda_stream The CUDA stream (cudaStream_t cast to void*)
+/// that orders the free.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_MemoryManagerFreeAsync(
+    TRITONBACKEND_MemoryManager* manager, void* buffer,
+    const int64_t memory_type_id, void* cuda_stream);
+
+/// Get usage statistics for the memory pool backing a memory type and
+/// ID. The statistics cover both synchronous and stream-ordered
+/// allocations from the pool and can be used to size the pools
+/// configured by TRITONSERVER_ServerOptionsSetPinnedMemoryPoolByteSize
+/// and TRITONSERVER_ServerOptionsSetCudaMemoryPoolByteSize from
+/// measured data.
+///
+/// \param manager The memory manager.
+/// \param memory_type The memory type of the pool.
+/// \param memory_type_id The ID associated with the memory type.
+/// \param bytes_in_use If non-nullptr, returns the number of bytes
+/// currently allocated from the pool.
+/// \param peak_bytes_in_use If non-nullptr, returns the high-water
+/// mark of bytes allocated from the pool.
+/// \param largest_free_block_byte_size If non-nullptr, returns the
+/// size, in bytes, of the largest contiguous block currently
+/// available in the pool, which together with the pool size indicates
+/// fragmentation.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_MemoryManagerPoolStats(
+    TRITONBACKEND_MemoryManager* manager,
+    const TRITONSERVER_MemoryType memory_type, const int64_t memory_type_id,
+    uint64_t* bytes_in_use, uint64_t* peak_bytes_in_use,
+    uint64_t* largest_free_block_byte_size);
+
 ///
 /// TRITONBACKEND_Input
 ///
@@ -230,6 +303,81 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_InputBuffer(
     uint64_t* buffer_byte_size, TRITONSERVER_MemoryType* memory_type,
     int64_t* memory_type_id);
 
+/// Get a buffer holding (part of) the tensor data for an input along
+/// with the buffer attributes describing it. The returned buffer and
+/// buffer attributes are owned by the input and should not be
+/// modified or freed by the caller, and should not be accessed after
+/// the input tensor object is released. The attributes carry the
+/// memory type, memory type id and byte size of the buffer and, for a
+/// registered GPU buffer appended with
+/// TRITONSERVER_InferenceRequestAppendInputDataWithBufferAttributes,
+/// its CUDA IPC handle and synchronization event.
+///
+/// \param input The input tensor.
+/// \param index The index of the buffer. Must be 0 <= index <
+/// buffer_count, where buffer_count is the value returned by
+/// TRITONBACKEND_InputProperties.
+/// \param buffer Returns a pointer to a contiguous block of data for
+/// the named input.
+/// \param buffer_attributes Returns the attributes of 'buffer'.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_InputBufferAttributes(
+    TRITONBACKEND_Input* input, const uint32_t index, const void** buffer,
+    TRITONSERVER_BufferAttributes** buffer_attributes);
+
+/// Get the buffer layout of a TRITONSERVER_TYPE_BYTES input, as set
+/// on the request with
+/// TRITONSERVER_InferenceRequestSetInputBytesLayout. For
+/// TRITONSERVER_BYTES_LAYOUT_OFFSETS the input is composed of exactly
+/// two buffers, accessed with TRITONBACKEND_InputBuffer: index 0
+/// holds the offsets region and index 1 holds the data region.
+/// TRITONSERVER_BYTES_LAYOUT_INLINE is returned for inputs of any
+/// other datatype.
+///
+/// \param input The input tensor.
+/// \param layout Returns the buffer layout of the input data.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_InputBytesLayout(
+    TRITONBACKEND_Input* input, TRITONSERVER_BytesLayout* layout);
+
+/// Collect the contents of a named input across a batch of requests
+/// into a single contiguous buffer, in request order. This is
+/// equivalent to iterating the requests passed to
+/// TRITONBACKEND_ModelInstanceExecute, getting the named input from
+/// each with TRITONBACKEND_RequestInput and copying each of its
+/// buffers into 'buffer' in sequence, but allows Triton to perform
+/// the gather as a fused operation: adjacent source fragments are
+/// coalesced into single copies and, for a device destination with
+/// many small fragments, a batched copy kernel is used in place of
+/// individual cudaMemcpyAsync calls.
+///
+/// For a TRITONSERVER_MEMORY_GPU destination the copies are enqueued
+/// on 'cuda_stream' and may still be in flight when this function
+/// returns; the backend must synchronize the stream before reading
+/// 'buffer'. For a CPU destination the gather is complete when this
+/// function returns and 'cuda_stream' is ignored.
+///
+/// \param requests The requests, as passed to
+/// TRITONBACKEND_ModelInstanceExecute.
+/// \param request_count The number of requests.
+/// \param input_name The name of the input to collect.
+/// \param buffer The buffer into which the input contents are
+/// gathered. The buffer is owned by the caller.
+/// \param buffer_byte_size The size, in bytes, of 'buffer'. An error
+/// with code TRITONSERVER_ERROR_INVALID_ARG is returned if the
+/// combined size of the input across the requests exceeds this size.
+/// \param memory_type The memory type of 'buffer'.
+/// \param memory_type_id The memory type id of 'buffer'.
+/// \param cuda_stream The CUDA stream (cudaStream_t cast to void*) on
+/// which to enqueue copies to a device destination. May be nullptr to
+/// indicate the default stream. Ignored for a CPU destination.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_InputCollect(
+    TRITONBACKEND_Request** requests, const uint32_t request_count,
+    const char* input_name, void* buffer, const uint64_t buffer_byte_size,
+    const TRITONSERVER_MemoryType memory_type, const int64_t memory_type_id,
+    void* cuda_stream);
+
 ///
 /// TRITONBACKEND_Output
 ///
@@ -259,6 +407,22 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_OutputBuffer(
     const uint64_t buffer_byte_size, TRITONSERVER_MemoryType* memory_type,
     int64_t* memory_type_id);
 
+/// Set the buffer layout of a TRITONSERVER_TYPE_BYTES output. Default
+/// is TRITONSERVER_BYTES_LAYOUT_INLINE. Must be called before
+/// TRITONBACKEND_OutputBuffer. For
+/// TRITONSERVER_BYTES_LAYOUT_OFFSETS the single buffer returned by
+/// TRITONBACKEND_OutputBuffer must be filled with the offsets region
+/// of (element_count + 1) int64 values followed immediately by the
+/// data region, with offsets relative to the start of the data
+/// region. An error with code TRITONSERVER_ERROR_INVALID_ARG is
+/// returned if the output's datatype is not TRITONSERVER_TYPE_BYTES.
+///
+/// \param output The output tensor.
+/// \param layout The buffer layout of the output data.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_OutputSetBytesLayout(
+    TRITONBACKEND_Output* output, const TRITONSERVER_BytesLayout layout);
+
 ///
 /// TRITONBACKEND_Request
 ///
@@ -381,6 +545,78 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_RequestOutputName(
 TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_RequestRelease(
     TRITONBACKEND_Request* request, uint32_t release_flags);
 
+///
+/// TRITONBACKEND_State
+///
+/// Object representing a sequence state tensor managed implicitly by
+/// Triton. For a model configured with implicit state, Triton stores
+/// the state tensors for each sequence (identified by correlation ID)
+/// between requests: the state produced while handling one request of
+/// the sequence is delivered as an input tensor of the next request,
+/// without the state ever being returned to the client or resent by
+/// it. The backend creates the new state for a request with
+/// TRITONBACKEND_StateNew, fills the state buffer, and commits it
+/// with TRITONBACKEND_StateUpdate.
+///
+
+/// Create a state tensor for a request. The lifetime of the returned
+/// state object matches that of the request and so the state object
+/// should not be accessed after the request object is released. An
+/// error is returned if the request does not belong to a sequence or
+/// if the model is not configured with an implicit state of the given
+/// name.
+///
+/// \param state Returns the new state.
+/// \param request The inference request the state is associated with.
+/// \param name The name of the state tensor.
+/// \param datatype The datatype of the state tensor.
+/// \param shape The shape of the state tensor.
+/// \param dims_count The number of dimensions in the state tensor
+/// shape.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_StateNew(
+    TRITONBACKEND_State** state, TRITONBACKEND_Request* request,
+    const char* name, const TRITONSERVER_DataType datatype,
+    const int64_t* shape, const uint32_t dims_count);
+
+/// Get a buffer to use to hold the tensor data for the state. The
+/// returned buffer is owned by the state and so should not be freed
+/// by the caller. The caller can and should fill the buffer with the
+/// state data. The buffer must not be accessed after
+/// TRITONBACKEND_StateUpdate is called for the state. When the
+/// requested memory type matches the memory type of the previous
+/// state of the sequence, Triton may return the previous state's
+/// buffer so that the backend can update the state in place.
+///
+/// \param state The state.
+/// \param buffer Returns a pointer to a buffer where the contents of
+/// the state tensor should be placed.
+/// \param buffer_byte_size The size, in bytes, of the buffer required
+/// by the caller.
+/// \param memory_type Acts as both input and output. On input gives
+/// the buffer memory type preferred by the caller.  Returns the
+/// actual memory type of 'buffer'.
+/// \param memory_type_id Acts as both input and output. On input
+/// gives the buffer memory type id preferred by the caller. Returns
+/// the actual memory type id of 'buffer'.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_StateBuffer(
+    TRITONBACKEND_State* state, void** buffer,
+    const uint64_t buffer_byte_size, TRITONSERVER_MemoryType* memory_type,
+    int64_t* memory_type_id);
+
+/// Commit a state so that it becomes the stored state of the
+/// sequence, delivered as an input tensor with the next request of
+/// the sequence. If TRITONBACKEND_StateUpdate is not called for a
+/// state, the sequence keeps its previous stored state. Must be
+/// called before the request that the state was created from is
+/// released.
+///
+/// \param state The state.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_StateUpdate(
+    TRITONBACKEND_State* state);
+
 ///
 /// TRITONBACKEND_ResponseFactory
 ///
@@ -391,6 +627,13 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_RequestRelease(
 /// to be released before all responses have been sent. Releasing a
 /// request as early as possible releases all input tensor data and
 /// therefore may be desirable in some cases.
+///
+/// For a model with the TRITONSERVER_TXN_DECOUPLED transaction
+/// property a response factory is the only way to produce responses:
+/// the backend creates zero-to-many responses for a request with
+/// TRITONBACKEND_ResponseNewFromFactory, sending each as it is
+/// produced, and signals that no more responses will be produced by
+/// sending the TRITONSERVER_RESPONSE_COMPLETE_FINAL flag.
 
 /// Create the response factory associated with a request.
 ///
@@ -418,6 +661,39 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
 TRITONBACKEND_ResponseFactorySendFlags(
     TRITONBACKEND_ResponseFactory* factory, const uint32_t send_flags);
 
+/// Set the maximum number of pending responses for a response
+/// factory. A response is pending from the time it is sent with
+/// TRITONBACKEND_ResponseSend until the frontend releases the
+/// response by deleting it. When the limit is reached,
+/// TRITONBACKEND_ResponseNewFromFactory blocks until a pending
+/// response is released, providing backpressure so a model that
+/// produces responses faster than the frontend can consume them does
+/// not buffer an unbounded number of output tensors. The default is
+/// 0, indicating no limit.
+///
+/// \param factory The response factory.
+/// \param max_pending_response_count The maximum number of pending
+/// responses, or 0 for no limit.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponseFactorySetMaxPendingResponses(
+    TRITONBACKEND_ResponseFactory* factory,
+    const uint32_t max_pending_response_count);
+
+/// Get the number of pending responses for a response factory. A
+/// backend producing a response stream can use this count to pace
+/// itself, for example by deferring further computation while the
+/// consumer is behind, instead of blocking in
+/// TRITONBACKEND_ResponseNewFromFactory.
+///
+/// \param factory The response factory.
+/// \param pending_response_count Returns the number of pending
+/// responses.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponseFactoryPendingResponseCount(
+    TRITONBACKEND_ResponseFactory* factory, uint32_t* pending_response_count);
+
 ///
 /// TRITONBACKEND_Response
 ///
@@ -518,6 +794,50 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ResponseOutput(
     const char* name, const TRITONSERVER_DataType datatype,
     const int64_t* shape, const uint32_t dims_count);
 
+/// Create all output tensors of a response and allocate their buffers
+/// with a single invocation of the frontend's response allocator.
+/// This is equivalent to calling TRITONBACKEND_ResponseOutput and
+/// TRITONBACKEND_OutputBuffer once per output, but the allocator is
+/// crossed only once for the entire response and so may place the
+/// buffers in one contiguous arena. As with
+/// TRITONBACKEND_OutputBuffer, the returned buffers are owned by the
+/// response outputs and should not be freed by the caller or accessed
+/// after the response object is released.
+///
+/// All outputs of the response must be provided in this one call; it
+/// must not be mixed with TRITONBACKEND_ResponseOutput for the same
+/// response.
+///
+/// \param response The response.
+/// \param output_count The number of output tensors.
+/// \param names The names of the output tensors, as an array of
+/// 'output_count' strings.
+/// \param datatypes The datatypes of the output tensors, as an array
+/// of 'output_count' entries.
+/// \param shapes The shapes of the output tensors, as an array of
+/// 'output_count' shape arrays.
+/// \param dims_counts The number of dimensions in each output tensor
+/// shape, as an array of 'output_count' entries.
+/// \param buffer_byte_sizes The size, in bytes, required for each
+/// output buffer, as an array of 'output_count' entries.
+/// \param buffers Returns a pointer to the buffer for each output
+/// tensor, as an array of 'output_count' entries.
+/// \param memory_type Acts as both input and output. On input gives
+/// the memory type preferred by the caller for all of the buffers.
+/// Returns the actual memory type of the buffers. All buffers of the
+/// response are placed in the same memory.
+/// \param memory_type_id Acts as both input and output. On input
+/// gives the memory type id preferred by the caller. Returns the
+/// actual memory type id of the buffers.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponseOutputsAllocate(
+    TRITONBACKEND_Response* response, const uint32_t output_count,
+    const char* const* names, const TRITONSERVER_DataType* datatypes,
+    const int64_t* const* shapes, const uint32_t* dims_counts,
+    const uint64_t* buffer_byte_sizes, void** buffers,
+    TRITONSERVER_MemoryType* memory_type, int64_t* memory_type_id);
+
 /// Send a response. Calling this function transfers ownership of the
 /// response object to Triton. The caller must not access or delete
 /// the response object after calling this function.
@@ -554,8 +874,25 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ResponseSend(
 ///     been sent and all requests have been released. This is the
 ///     default execution policy.
 ///
+///   TRITONBACKEND_EXECUTION_DEVICE_BLOCKING: An instance of the
+///     model blocks in TRITONBACKEND_ModelInstanceExecute only until
+///     the device associated with the instance is ready to handle
+///     another batch. For backends that launch asynchronous device
+///     work (for example, CUDA kernels) the backend may return from
+///     TRITONBACKEND_ModelInstanceExecute as soon as the work for the
+///     batch is launched, signaling completion later through the
+///     responses created from a TRITONBACKEND_ResponseFactory. Triton
+///     may then call TRITONBACKEND_ModelInstanceExecute for the same
+///     instance with a new batch of requests while earlier batches
+///     are still executing on the device, allowing input preparation
+///     for one batch to overlap device execution of the previous
+///     batch. The backend is responsible for ensuring that batches
+///     for a given instance execute on the device in the order they
+///     are delivered.
+///
 typedef enum TRITONBACKEND_execpolicy_enum {
-  TRITONBACKEND_EXECUTION_BLOCKING
+  TRITONBACKEND_EXECUTION_BLOCKING,
+  TRITONBACKEND_EXECUTION_DEVICE_BLOCKING
 } TRITONBACKEND_ExecutionPolicy;
 
 /// Get the name of the backend. The caller does not own the returned
@@ -748,6 +1085,45 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelSetConfig(
     TRITONBACKEND_Model* model, const uint32_t config_version,
     TRITONSERVER_Message* model_config);
 
+/// Declare whether the model's artifacts may be delivered to the
+/// backend as read-only memory mappings. This function can only be
+/// called from TRITONBACKEND_ModelInitialize, calling in any other
+/// context will result in an error being returned. When a backend
+/// declares support and memory-mapped loading is enabled with
+/// TRITONSERVER_ServerOptionsSetModelLoadMemoryMapping, Triton maps
+/// the files in the model's version directory read-only with a
+/// sequential prefetch hint and makes the mappings available via
+/// TRITONBACKEND_ModelArtifactMemoryMap. The backend must not write
+/// through the mappings. Default is false.
+///
+/// \param model The model.
+/// \param memory_map True if the backend can consume memory-mapped
+/// artifacts, false otherwise.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelSetMemoryMappedArtifacts(
+    TRITONBACKEND_Model* model, const bool memory_map);
+
+/// Get the read-only memory mapping for a model artifact. The mapping
+/// is owned by Triton and shared across all instances of the model;
+/// it remains valid until the model is unloaded and must not be
+/// modified or unmapped by the backend. An error with code
+/// TRITONSERVER_ERROR_UNAVAILABLE is returned if the artifact is not
+/// memory mapped, in which case the backend should fall back to
+/// reading the file from the location returned by
+/// TRITONBACKEND_ModelRepository.
+///
+/// \param model The model.
+/// \param artifact_name The name of the artifact file, relative to
+/// the model's version directory.
+/// \param base Returns the base address of the mapping.
+/// \param byte_size Returns the size, in bytes, of the mapping.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelArtifactMemoryMap(
+    TRITONBACKEND_Model* model, const char* artifact_name, const void** base,
+    uint64_t* byte_size);
+
 /// Get the TRITONSERVER_Server object that this model is being served
 /// by.
 ///
@@ -817,6 +1193,23 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelInstanceKind(
 TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelInstanceDeviceId(
     TRITONBACKEND_ModelInstance* instance, int32_t* device_id);
 
+/// Get the host policy of the model instance as a message in JSON
+/// format, holding the settings configured for the policy with
+/// TRITONSERVER_ServerOptionsSetHostPolicy. If the instance is not
+/// associated with a host policy the message holds an empty JSON
+/// object. The backend should use the policy to place the threads and
+/// allocations it creates for the instance on the indicated processor
+/// and memory domain. The caller takes ownership of the message
+/// object and must call TRITONSERVER_MessageDelete to release the
+/// object.
+///
+/// \param instance The model instance.
+/// \param host_policy Returns the host policy settings as a message.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceHostPolicy(
+    TRITONBACKEND_ModelInstance* instance, TRITONSERVER_Message** host_policy);
+
 /// Whether the model instance is passive.
 ///
 /// \param instance The model instance.
@@ -0,0 +1,209 @@
+// Copyright (c) 2021, NVIDIA CORPORATION. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "triton/core/tritonserver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef _COMPILING_TRITONCACHE
+#if defined(_MSC_VER)
+#define TRITONCACHE_DECLSPEC __declspec(dllexport)
+#define TRITONCACHE_ISPEC __declspec(dllimport)
+#elif defined(__GNUC__)
+#define TRITONCACHE_DECLSPEC __attribute__((__visibility__("default")))
+#define TRITONCACHE_ISPEC
+#else
+#define TRITONCACHE_DECLSPEC
+#define TRITONCACHE_ISPEC
+#endif
+#else
+#if defined(_MSC_VER)
+#define TRITONCACHE_DECLSPEC __declspec(dllimport)
+#define TRITONCACHE_ISPEC __declspec(dllexport)
+#else
+#define TRITONCACHE_DECLSPEC
+#define TRITONCACHE_ISPEC
+#endif
+#endif
+
+struct TRITONCACHE_Cache;
+struct TRITONCACHE_CacheEntry;
+
+///
+/// TRITONCACHE API Version
+///
+/// The TRITONCACHE API is versioned with major and minor version
+/// numbers. Any change to the API that does not impact backwards
+/// compatibility (for example, adding a non-required function)
+/// increases the minor version number. Any change that breaks
+/// backwards compatibility (for example, deleting or changing the
+/// behavior of a function) increases the major version number. A
+/// cache implementation should check that the API version used to
+/// compile the cache is compatible with the API version of the Triton
+/// server that it is running in. This is typically done by code
+/// similar to the following which makes sure that the major versions
+/// are equal and that the minor version of Triton is >= the minor
+/// version used to build the cache.
+///
+///   uint32_t api_version_major, api_version_minor;
+///   TRITONCACHE_ApiVersion(&api_version_major, &api_version_minor);
+///   if ((api_version_major != TRITONCACHE_API_VERSION_MAJOR) ||
+///       (api_version_minor < TRITONCACHE_API_VERSION_MINOR)) {
+///     return TRITONSERVER_ErrorNew(
+///       TRITONSERVER_ERROR_UNSUPPORTED,
+///       "triton cache API version does not support this cache");
+///   }
+///
+#define TRITONCACHE_API_VERSION_MAJOR 0
+#define TRITONCACHE_API_VERSION_MINOR 1
+
+/// Get the TRITONCACHE API version supported by Triton. This value
+/// can be compared against the TRITONCACHE_API_VERSION_MAJOR and
+/// TRITONCACHE_API_VERSION_MINOR used to build the cache to ensure
+/// that Triton is compatible with the cache.
+///
+/// \param major Returns the TRITONCACHE API major version supported
+/// by Triton.
+/// \param minor Returns the TRITONCACHE API minor version supported
+/// by Triton.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONCACHE_DECLSPEC TRITONSERVER_Error* TRITONCACHE_ApiVersion(
+    uint32_t* major, uint32_t* minor);
+
+///
+/// TRITONCACHE_CacheEntry
+///
+/// Object representing the value associated with a cache key: the
+/// serialized output tensors of one inference response. An entry
+/// holds one or more buffers. For a lookup the cache adds the buffers
+/// that make up the cached response to the entry provided by Triton;
+/// for an insert Triton adds the buffers that make up the response to
+/// be cached and the cache copies them into its own storage before
+/// returning.
+///
+
+/// Get the number of buffers held by a cache entry.
+///
+/// \param entry The cache entry.
+/// \param count Returns the number of buffers.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONCACHE_DECLSPEC TRITONSERVER_Error* TRITONCACHE_CacheEntryBufferCount(
+    TRITONCACHE_CacheEntry* entry, uint32_t* count);
+
+/// Get a buffer held by a cache entry. The returned buffer is owned
+/// by the entry and must not be modified or freed by the caller. The
+/// lifetime of the buffer extends only as long as 'entry'.
+///
+/// \param entry The cache entry.
+/// \param index The index of the buffer. Must be 0 <= index < count,
+/// where count is the value returned by
+/// TRITONCACHE_CacheEntryBufferCount.
+/// \param base Returns the base of the buffer.
+/// \param byte_size Returns the size, in bytes, of the buffer.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONCACHE_DECLSPEC TRITONSERVER_Error* TRITONCACHE_CacheEntryBuffer(
+    TRITONCACHE_CacheEntry* entry, const uint32_t index, const void** base,
+    size_t* byte_size);
+
+/// Add a buffer to a cache entry. The entry copies the buffer
+/// contents and so the caller retains ownership of 'base' and may
+/// free it after this call returns.
+///
+/// \param entry The cache entry.
+/// \param base The base of the buffer to add.
+/// \param byte_size The size, in bytes, of the buffer.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONCACHE_DECLSPEC TRITONSERVER_Error* TRITONCACHE_CacheEntryAddBuffer(
+    TRITONCACHE_CacheEntry* entry, const void* base, size_t byte_size);
+
+///
+/// The following functions can be implemented by a cache. Functions
+/// indicated as required must be implemented or the cache will fail
+/// to load.
+///
+
+/// Initialize a new cache object. This function is required. This
+/// function is called once when the cache is loaded to allow the
+/// cache to allocate any state associated with it.
+///
+/// \param cache Returns the new cache object.
+/// \param cache_config Serialized JSON configuration for the cache as
+/// set by TRITONSERVER_ServerOptionsSetCacheConfig. The string is
+/// owned by Triton and is valid only for the duration of the call.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONCACHE_ISPEC TRITONSERVER_Error* TRITONCACHE_CacheInitialize(
+    TRITONCACHE_Cache** cache, const char* cache_config);
+
+/// Finalize a cache object. This function is required. This function
+/// is called once, just before the cache is unloaded. All state
+/// associated with the cache should be freed and any threads created
+/// for the cache should be exited/joined before returning from this
+/// function.
+///
+/// \param cache The cache object.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONCACHE_ISPEC TRITONSERVER_Error* TRITONCACHE_CacheFinalize(
+    TRITONCACHE_Cache* cache);
+
+/// Lookup a key in the cache. This function is required. If the key
+/// is found the cache must add the buffers that make up the cached
+/// response to 'entry' using TRITONCACHE_CacheEntryAddBuffer and
+/// return success. If the key is not found the cache must return a
+/// TRITONSERVER_Error with code TRITONSERVER_ERROR_NOT_FOUND. A hit
+/// bypasses scheduling and TRITONBACKEND_ModelInstanceExecute
+/// entirely, so this function is called on the request hot path and
+/// must be thread-safe.
+///
+/// \param cache The cache object.
+/// \param key The hashed key for the request being looked up.
+/// \param entry The entry to be populated with the cached response
+/// buffers, owned by Triton.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONCACHE_ISPEC TRITONSERVER_Error* TRITONCACHE_CacheLookup(
+    TRITONCACHE_Cache* cache, const char* key, TRITONCACHE_CacheEntry* entry);
+
+/// Insert an entry into the cache. This function is required. The
+/// buffers held by 'entry' are owned by Triton and are valid only for
+/// the duration of the call, so the cache must copy them into its own
+/// storage. If the key already exists the cache must return a
+/// TRITONSERVER_Error with code TRITONSERVER_ERROR_ALREADY_EXISTS.
+/// This function must be thread-safe.
+///
+/// \param cache The cache object.
+/// \param key The hashed key for the response being inserted.
+/// \param entry The entry holding the response buffers to insert.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONCACHE_ISPEC TRITONSERVER_Error* TRITONCACHE_CacheInsert(
+    TRITONCACHE_Cache* cache, const char* key, TRITONCACHE_CacheEntry* entry);
+
+#ifdef __cplusplus
+}
+#endif
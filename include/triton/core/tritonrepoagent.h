@@ -83,7 +83,7 @@ struct TRITONREPOAGENT_AgentModel;
 ///   }
 ///
 #define TRITONREPOAGENT_API_VERSION_MAJOR 0
-#define TRITONREPOAGENT_API_VERSION_MINOR 1
+#define TRITONREPOAGENT_API_VERSION_MINOR 2
 
 /// Get the TRITONREPOAGENT API version supported by Triton. This
 /// value can be compared against the
@@ -210,6 +210,31 @@ TRITONREPOAGENT_ModelRepositoryLocationAcquire(
     TRITONREPOAGENT_Agent* agent, TRITONREPOAGENT_AgentModel* model,
     const TRITONREPOAGENT_ArtifactType artifact_type, const char** location);
 
+/// Acquire a location that the agent can stream model artifacts
+/// directly into. Unlike TRITONREPOAGENT_ModelRepositoryLocationAcquire,
+/// the returned location is the final location that Triton will serve
+/// the model repository from if the agent reports it with
+/// TRITONREPOAGENT_ModelRepositoryUpdate, so an agent that fetches
+/// artifacts from a remote source can write them straight into place
+/// instead of staging them in a temporary directory that is then
+/// copied. The agent is responsible for calling
+/// TRITONREPOAGENT_ModelRepositoryLocationRelease in
+/// TRITONREPOAGENT_ModelFinalize to release the location. Initially
+/// the acquired location is empty. Only
+/// TRITONREPOAGENT_ARTIFACT_FILESYSTEM locations can be acquired with
+/// this function.
+///
+/// \param agent The agent.
+/// \param model The model.
+/// \param artifact_type The artifact type for the location. Must be
+/// TRITONREPOAGENT_ARTIFACT_FILESYSTEM.
+/// \param path Returns the location.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONREPOAGENT_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_ModelRepositoryLocationAcquireStreamed(
+    TRITONREPOAGENT_Agent* agent, TRITONREPOAGENT_AgentModel* model,
+    const TRITONREPOAGENT_ArtifactType artifact_type, const char** location);
+
 /// Discard and release ownership of a previously acquired location
 /// and its contents. The agent must not access or modify the location
 /// or its contents after this call.
@@ -256,6 +281,38 @@ TRITONREPOAGENT_ModelRepositoryUpdate(
     TRITONREPOAGENT_Agent* agent, TRITONREPOAGENT_AgentModel* model,
     const TRITONREPOAGENT_ArtifactType artifact_type, const char* location);
 
+/// Inform Triton that the specified repository location should be
+/// composed as an overlay on top of the model's original repository.
+/// This method can only be called when TRITONREPOAGENT_ModelAction is
+/// invoked with TRITONREPOAGENT_ACTION_LOAD. The files present in
+/// 'location', identified by their paths relative to the location
+/// root, replace the files at the same relative paths in the original
+/// repository; all other files are served from the original
+/// repository without being copied. This allows an agent that
+/// validates or rewrites only a few files of a large model (for
+/// example, decrypting the configuration while leaving the weight
+/// files untouched) to avoid materializing a full copy of the
+/// repository.
+///
+/// Ownership of the contents of 'location' is transferred to Triton
+/// and the agent should not modify or free the contents until
+/// TRITONREPOAGENT_ModelFinalize. Only
+/// TRITONREPOAGENT_ARTIFACT_FILESYSTEM locations can be used as an
+/// overlay. At most one of TRITONREPOAGENT_ModelRepositoryUpdate and
+/// TRITONREPOAGENT_ModelRepositoryUpdateOverlay may be called for a
+/// given load action.
+///
+/// \param agent The agent.
+/// \param model The model.
+/// \param artifact_type The artifact type for the location. Must be
+/// TRITONREPOAGENT_ARTIFACT_FILESYSTEM.
+/// \param location The location holding the replacement files.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONREPOAGENT_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_ModelRepositoryUpdateOverlay(
+    TRITONREPOAGENT_Agent* agent, TRITONREPOAGENT_AgentModel* model,
+    const TRITONREPOAGENT_ArtifactType artifact_type, const char* location);
+
 /// Get the number of agent parameters defined for a model.
 ///
 /// \param agent The agent.
@@ -51,15 +51,22 @@ extern "C" {
 #endif
 #endif
 
+struct TRITONSERVER_BufferAttributes;
+struct TRITONSERVER_BufferRegistration;
+struct TRITONSERVER_CompletionQueue;
 struct TRITONSERVER_Error;
 struct TRITONSERVER_InferenceRequest;
+struct TRITONSERVER_InferenceRequestPool;
 struct TRITONSERVER_InferenceResponse;
 struct TRITONSERVER_InferenceTrace;
 struct TRITONSERVER_Message;
+struct TRITONSERVER_Metric;
+struct TRITONSERVER_MetricFamily;
 struct TRITONSERVER_Metrics;
 struct TRITONSERVER_ResponseAllocator;
 struct TRITONSERVER_Server;
 struct TRITONSERVER_ServerOptions;
+struct TRITONSERVER_TraceBuffer;
 
 ///
 /// TRITONSERVER API Version
@@ -87,7 +94,7 @@ struct TRITONSERVER_ServerOptions;
 ///   }
 ///
 #define TRITONSERVER_API_VERSION_MAJOR 1
-#define TRITONSERVER_API_VERSION_MINOR 1
+#define TRITONSERVER_API_VERSION_MINOR 24
 
 /// Get the TRITONBACKEND API version supported by the Triton shared
 /// library. This value can be compared against the
@@ -150,6 +157,27 @@ TRITONSERVER_StringToDataType(const char* dtype);
 TRITONSERVER_DECLSPEC uint32_t
 TRITONSERVER_DataTypeByteSize(TRITONSERVER_DataType datatype);
 
+/// TRITONSERVER_BytesLayout
+///
+/// Buffer layouts for TRITONSERVER_TYPE_BYTES tensors.
+///
+///   TRITONSERVER_BYTES_LAYOUT_INLINE: Each element is encoded
+///   in-place as a 4-byte little-endian length followed by that many
+///   bytes of data. Locating element N requires a serial scan of the
+///   preceding elements. This is the default layout.
+///
+///   TRITONSERVER_BYTES_LAYOUT_OFFSETS: The element data is held in a
+///   contiguous data region and is described by a separate offsets
+///   region of (element_count + 1) little-endian int64 values, where
+///   element N occupies bytes [offsets[N], offsets[N+1]) of the data
+///   region. Locating any element is O(1) and splitting a batch is
+///   pointer arithmetic over the offsets.
+///
+typedef enum TRITONSERVER_byteslayout_enum {
+  TRITONSERVER_BYTES_LAYOUT_INLINE,
+  TRITONSERVER_BYTES_LAYOUT_OFFSETS
+} TRITONSERVER_BytesLayout;
+
 /// TRITONSERVER_MemoryType
 ///
 /// Types of memory recognized by TRITONSERVER.
@@ -188,6 +216,138 @@ typedef enum TRITONSERVER_parametertype_enum {
 TRITONSERVER_DECLSPEC const char* TRITONSERVER_ParameterTypeString(
     TRITONSERVER_ParameterType paramtype);
 
+/// TRITONSERVER_BufferAttributes
+///
+/// API to create, modify, or retrieve attributes associated with a
+/// buffer, including the CUDA IPC handle that allows a GPU buffer
+/// allocated in another process to be used without copying its
+/// contents.
+///
+
+/// Create a new buffer attributes object. The caller takes ownership
+/// of the TRITONSERVER_BufferAttributes object and must call
+/// TRITONSERVER_BufferAttributesDelete to release the object.
+///
+/// \param buffer_attributes Returns the new buffer attributes object.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_BufferAttributesNew(
+    TRITONSERVER_BufferAttributes** buffer_attributes);
+
+/// Delete a buffer attributes object.
+///
+/// \param buffer_attributes The buffer attributes object.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_BufferAttributesDelete(
+    TRITONSERVER_BufferAttributes* buffer_attributes);
+
+/// Set the memory type id field of the buffer attributes.
+///
+/// \param buffer_attributes The buffer attributes object.
+/// \param memory_type_id The memory type id to set.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_BufferAttributesSetMemoryTypeId(
+    TRITONSERVER_BufferAttributes* buffer_attributes, int64_t memory_type_id);
+
+/// Set the memory type field of the buffer attributes.
+///
+/// \param buffer_attributes The buffer attributes object.
+/// \param memory_type The memory type to set.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_BufferAttributesSetMemoryType(
+    TRITONSERVER_BufferAttributes* buffer_attributes,
+    TRITONSERVER_MemoryType memory_type);
+
+/// Set the CudaIpcHandle field of the buffer attributes. Only
+/// meaningful for a buffer of memory type TRITONSERVER_MEMORY_GPU;
+/// the handle (cudaIpcMemHandle_t cast to void*) allows the buffer to
+/// be opened in the server process without copying the data.
+///
+/// \param buffer_attributes The buffer attributes object.
+/// \param cuda_ipc_handle The CudaIpcHandle to set.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_BufferAttributesSetCudaIpcHandle(
+    TRITONSERVER_BufferAttributes* buffer_attributes, void* cuda_ipc_handle);
+
+/// Set the CudaIpcEventHandle field of the buffer attributes. Only
+/// meaningful for a buffer of memory type TRITONSERVER_MEMORY_GPU;
+/// the handle (cudaIpcEventHandle_t cast to void*) names an event
+/// that the consumer of the buffer must wait on before reading the
+/// contents, allowing the producer to share the buffer while writes
+/// to it are still in flight on a stream.
+///
+/// \param buffer_attributes The buffer attributes object.
+/// \param cuda_ipc_event_handle The CudaIpcEventHandle to set.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_BufferAttributesSetCudaIpcEventHandle(
+    TRITONSERVER_BufferAttributes* buffer_attributes,
+    void* cuda_ipc_event_handle);
+
+/// Set the byte size field of the buffer attributes.
+///
+/// \param buffer_attributes The buffer attributes object.
+/// \param byte_size The byte size to set.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_BufferAttributesSetByteSize(
+    TRITONSERVER_BufferAttributes* buffer_attributes, size_t byte_size);
+
+/// Get the memory type id field of the buffer attributes.
+///
+/// \param buffer_attributes The buffer attributes object.
+/// \param memory_type_id Returns the memory type id associated with
+/// the buffer attributes object.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_BufferAttributesMemoryTypeId(
+    TRITONSERVER_BufferAttributes* buffer_attributes, int64_t* memory_type_id);
+
+/// Get the memory type field of the buffer attributes.
+///
+/// \param buffer_attributes The buffer attributes object.
+/// \param memory_type Returns the memory type associated with the
+/// buffer attributes object.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_BufferAttributesMemoryType(
+    TRITONSERVER_BufferAttributes* buffer_attributes,
+    TRITONSERVER_MemoryType* memory_type);
+
+/// Get the CudaIpcHandle field of the buffer attributes object.
+///
+/// \param buffer_attributes The buffer attributes object.
+/// \param cuda_ipc_handle Returns the CudaIpcHandle associated with
+/// the buffer attributes object. Returns nullptr if the buffer
+/// attributes object does not have a CudaIpcHandle.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_BufferAttributesCudaIpcHandle(
+    TRITONSERVER_BufferAttributes* buffer_attributes, void** cuda_ipc_handle);
+
+/// Get the CudaIpcEventHandle field of the buffer attributes object.
+///
+/// \param buffer_attributes The buffer attributes object.
+/// \param cuda_ipc_event_handle Returns the CudaIpcEventHandle
+/// associated with the buffer attributes object. Returns nullptr if
+/// the buffer attributes object does not have a CudaIpcEventHandle.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_BufferAttributesCudaIpcEventHandle(
+    TRITONSERVER_BufferAttributes* buffer_attributes,
+    void** cuda_ipc_event_handle);
+
+/// Get the byte size field of the buffer attributes.
+///
+/// \param buffer_attributes The buffer attributes object.
+/// \param byte_size Returns the byte size associated with the buffer
+/// attributes object.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_BufferAttributesByteSize(
+    TRITONSERVER_BufferAttributes* buffer_attributes, size_t* byte_size);
+
 /// TRITONSERVER_InstanceGroupKind
 ///
 /// Kinds of instance groups recognized by TRITONSERVER.
@@ -256,7 +416,8 @@ typedef enum TRITONSERVER_errorcode_enum {
   TRITONSERVER_ERROR_INVALID_ARG,
   TRITONSERVER_ERROR_UNAVAILABLE,
   TRITONSERVER_ERROR_UNSUPPORTED,
-  TRITONSERVER_ERROR_ALREADY_EXISTS
+  TRITONSERVER_ERROR_ALREADY_EXISTS,
+  TRITONSERVER_ERROR_DEADLINE_EXCEEDED
 } TRITONSERVER_Error_Code;
 
 /// Create a new error object. The caller takes ownership of the
@@ -378,6 +539,44 @@ typedef TRITONSERVER_Error* (*TRITONSERVER_ResponseAllocatorReleaseFn_t)(
 typedef TRITONSERVER_Error* (*TRITONSERVER_ResponseAllocatorStartFn_t)(
     TRITONSERVER_ResponseAllocator* allocator, void* userp);
 
+/// Type for function that is called to query the allocator's
+/// preferred memory type and memory type ID for an allocation, and to
+/// communicate the expected allocation size before the allocation is
+/// requested. As much as possible, the allocator should attempt to
+/// return the same memory_type and memory_type_id values that will be
+/// returned by the subsequent call to
+/// TRITONSERVER_ResponseAllocatorAllocFn_t. If the allocator is able
+/// to use the query to prepare the allocation (for example, by
+/// reserving 'byte_size' bytes from a pool), the subsequent alloc_fn
+/// call can complete without taking a slow path. But if an allocation
+/// is not made with the preferred values the inference will still
+/// succeed, with an extra copy if needed.
+///
+/// \param allocator The allocator that is provided in the call to
+/// TRITONSERVER_InferenceRequestSetResponseCallback.
+/// \param userp The user data pointer that is provided as
+/// 'response_allocator_userp' in the call to
+/// TRITONSERVER_InferenceRequestSetResponseCallback.
+/// \param tensor_name The name of the output tensor. This is optional
+/// and it should be set to nullptr to indicate that the tensor name has
+/// not determined.
+/// \param byte_size The expected size of the buffer. This is optional
+/// and it should be set to nullptr to indicate that the byte size has
+/// not determined.
+/// \param memory_type Acts as both input and output. On input gives
+/// the memory type preferred by the caller. Returns memory type
+/// preferred by the allocator, taken account of the caller preferred
+/// type.
+/// \param memory_type_id Acts as both input and output. On input
+/// gives the memory type ID preferred by the caller. Returns memory
+/// type ID preferred by the allocator, taken account of the caller
+/// preferred type ID.
+/// \return a TRITONSERVER_Error object if a failure occurs.
+typedef TRITONSERVER_Error* (*TRITONSERVER_ResponseAllocatorQueryFn_t)(
+    TRITONSERVER_ResponseAllocator* allocator, void* userp,
+    const char* tensor_name, size_t* byte_size,
+    TRITONSERVER_MemoryType* memory_type, int64_t* memory_type_id);
+
 /// Create a new response allocator object.
 ///
 /// The response allocator object is used by Triton to allocate
@@ -434,6 +633,21 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ResponseAllocatorNew(
     TRITONSERVER_ResponseAllocatorReleaseFn_t release_fn,
     TRITONSERVER_ResponseAllocatorStartFn_t start_fn);
 
+/// Set the query function to a response allocator object. Usually the
+/// function will be called before alloc_fn to understand what is the
+/// allocator's preferred memory type and memory type ID at the current
+/// situation to make different execution decision, and to give the
+/// allocator a chance to prepare for the coming allocation.
+///
+/// \param allocator The response allocator object.
+/// \param query_fn The function to call to query allocator's preferred memory
+/// type and memory type ID.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ResponseAllocatorSetQueryFunction(
+    TRITONSERVER_ResponseAllocator* allocator,
+    TRITONSERVER_ResponseAllocatorQueryFn_t query_fn);
+
 /// Delete a response allocator.
 ///
 /// \param allocator The response allocator object.
@@ -518,6 +732,146 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_MetricsFormatted(
     TRITONSERVER_Metrics* metrics, TRITONSERVER_MetricFormat format,
     const char** base, size_t* byte_size);
 
+/// TRITONSERVER_MetricFamily
+///
+/// Object representing a family of user-defined metrics that share a
+/// name, description and kind but have distinct label values. Metrics
+/// created from a family are updated directly by the caller — for
+/// example from backend threads during
+/// TRITONBACKEND_ModelInstanceExecute — with the cost of a relaxed
+/// atomic operation; no lock is taken and no text is formatted until
+/// the metrics are serialized by a TRITONSERVER_ServerMetrics scrape,
+/// where they are reported alongside Triton's own metrics.
+///
+
+/// TRITONSERVER_MetricKind
+///
+/// Kinds of metric families recognized by TRITONSERVER.
+///
+typedef enum TRITONSERVER_metrickind_enum {
+  TRITONSERVER_METRIC_KIND_COUNTER,
+  TRITONSERVER_METRIC_KIND_GAUGE,
+  TRITONSERVER_METRIC_KIND_HISTOGRAM
+} TRITONSERVER_MetricKind;
+
+/// Create a new metric family object. The caller takes ownership of
+/// the TRITONSERVER_MetricFamily object and must call
+/// TRITONSERVER_MetricFamilyDelete to release the object. A family
+/// must not be deleted until all metrics created from it have been
+/// deleted.
+///
+/// \param family Returns the new metric family object.
+/// \param kind The kind of metric family to create.
+/// \param name The name of the metric family as seen by the metrics
+/// exporter.
+/// \param description The description of the metric family as seen by
+/// the metrics exporter.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_MetricFamilyNew(
+    TRITONSERVER_MetricFamily** family, const TRITONSERVER_MetricKind kind,
+    const char* name, const char* description);
+
+/// Delete a metric family object.
+///
+/// \param family The metric family object.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_MetricFamilyDelete(
+    TRITONSERVER_MetricFamily* family);
+
+/// TRITONSERVER_Metric
+///
+/// A single metric within a metric family, identified by its label
+/// values.
+///
+
+/// Create a new metric object from a family. The caller takes
+/// ownership of the TRITONSERVER_Metric object and must call
+/// TRITONSERVER_MetricDelete to release the object. The metric is
+/// created once and then updated from any thread; creation is the
+/// only operation that takes a lock.
+///
+/// \param metric Returns the new metric object.
+/// \param family The metric family to create the metric from.
+/// \param label_names The names of the labels for the metric.
+/// \param label_values The values of the labels for the metric, one
+/// entry for each entry of 'label_names'.
+/// \param label_count The number of labels. May be zero.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_MetricNew(
+    TRITONSERVER_Metric** metric, TRITONSERVER_MetricFamily* family,
+    const char** label_names, const char** label_values,
+    const uint32_t label_count);
+
+/// Delete a metric object.
+///
+/// \param metric The metric object.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_MetricDelete(
+    TRITONSERVER_Metric* metric);
+
+/// Increment the current value of a metric by a given amount. For a
+/// metric of kind TRITONSERVER_METRIC_KIND_COUNTER 'value' must be
+/// non-negative. This function is thread-safe and costs a relaxed
+/// atomic add. An error with code TRITONSERVER_ERROR_UNSUPPORTED is
+/// returned for a metric of kind TRITONSERVER_METRIC_KIND_HISTOGRAM,
+/// use TRITONSERVER_MetricObserve instead.
+///
+/// \param metric The metric object.
+/// \param value The amount to increment the metric by.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_MetricIncrement(
+    TRITONSERVER_Metric* metric, const double value);
+
+/// Set the current value of a metric. Only supported for a metric of
+/// kind TRITONSERVER_METRIC_KIND_GAUGE, an error with code
+/// TRITONSERVER_ERROR_UNSUPPORTED is returned for other kinds. This
+/// function is thread-safe.
+///
+/// \param metric The metric object.
+/// \param value The value to set the metric to.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_MetricSet(
+    TRITONSERVER_Metric* metric, const double value);
+
+/// Record an observation for a metric of kind
+/// TRITONSERVER_METRIC_KIND_HISTOGRAM, an error with code
+/// TRITONSERVER_ERROR_UNSUPPORTED is returned for other kinds. The
+/// observation is counted into the buckets set by
+/// TRITONSERVER_MetricSetHistogramBuckets. This function is
+/// thread-safe and costs one relaxed atomic add per observation.
+///
+/// \param metric The metric object.
+/// \param value The value to observe.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_MetricObserve(
+    TRITONSERVER_Metric* metric, const double value);
+
+/// Set the bucket upper bounds for a metric of kind
+/// TRITONSERVER_METRIC_KIND_HISTOGRAM, an error with code
+/// TRITONSERVER_ERROR_UNSUPPORTED is returned for other kinds. The
+/// buckets must be set before the first call to
+/// TRITONSERVER_MetricObserve for the metric.
+///
+/// \param metric The metric object.
+/// \param buckets The bucket upper bounds, in increasing order.
+/// \param bucket_count The number of entries in 'buckets'.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_MetricSetHistogramBuckets(
+    TRITONSERVER_Metric* metric, const double* buckets,
+    const uint32_t bucket_count);
+
+/// Get the current value of a metric. Only supported for metrics of
+/// kind TRITONSERVER_METRIC_KIND_COUNTER and
+/// TRITONSERVER_METRIC_KIND_GAUGE, an error with code
+/// TRITONSERVER_ERROR_UNSUPPORTED is returned for other kinds.
+///
+/// \param metric The metric object.
+/// \param value Returns the current value of the metric.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_MetricValue(
+    TRITONSERVER_Metric* metric, double* value);
+
 /// TRITONSERVER_InferenceTrace
 ///
 /// Object that represents tracing for an inference request.
@@ -547,7 +901,11 @@ typedef enum tritonserver_traceactivity_enum {
   TRITONSERVER_TRACE_COMPUTE_INPUT_END = 3,
   TRITONSERVER_TRACE_COMPUTE_OUTPUT_START = 4,
   TRITONSERVER_TRACE_COMPUTE_END = 5,
-  TRITONSERVER_TRACE_REQUEST_END = 6
+  TRITONSERVER_TRACE_REQUEST_END = 6,
+  TRITONSERVER_TRACE_INPUT_GATHER_START = 7,
+  TRITONSERVER_TRACE_INPUT_GATHER_END = 8,
+  TRITONSERVER_TRACE_OUTPUT_COPY_START = 9,
+  TRITONSERVER_TRACE_OUTPUT_COPY_END = 10
 } TRITONSERVER_InferenceTraceActivity;
 
 /// Get the string representation of a trace activity. The returned
@@ -653,6 +1011,192 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error*
 TRITONSERVER_InferenceTraceModelVersion(
     TRITONSERVER_InferenceTrace* trace, int64_t* model_version);
 
+/// TRITONSERVER_TraceBuffer
+///
+/// Object representing a binary trace buffer. A trace buffer is an
+/// alternative to the per-activity callback of
+/// TRITONSERVER_InferenceTraceNew: activity for traces created with
+/// TRITONSERVER_InferenceTraceBufferNew is recorded as fixed-size
+/// binary records written into per-thread lock-free rings, so
+/// recording an activity costs a few stores with no allocation, lock
+/// or cross-module call. A single consumer thread drains the records
+/// in bulk with TRITONSERVER_TraceBufferConsume.
+///
+/// Each record is 24 bytes, with all fields little-endian and no
+/// padding:
+///
+///   uint64_t trace_id;      id as reported by
+///                           TRITONSERVER_InferenceTraceId
+///   uint32_t activity;      a TRITONSERVER_InferenceTraceActivity
+///                           value
+///   uint32_t reserved;      currently 0
+///   uint64_t timestamp_ns;  activity timestamp
+///
+
+/// Create a new trace buffer object. The caller takes ownership of
+/// the TRITONSERVER_TraceBuffer object and must call
+/// TRITONSERVER_TraceBufferDelete to release the object.
+///
+/// \param trace_buffer Returns the new trace buffer object.
+/// \param byte_size The total size, in bytes, of the buffer. If
+/// records are produced faster than they are consumed and the buffer
+/// fills, the oldest unconsumed records are overwritten.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_TraceBufferNew(
+    TRITONSERVER_TraceBuffer** trace_buffer, const uint64_t byte_size);
+
+/// Delete a trace buffer object. The buffer must not be deleted while
+/// any trace created with TRITONSERVER_InferenceTraceBufferNew
+/// against the buffer is still live.
+///
+/// \param trace_buffer The trace buffer object.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_TraceBufferDelete(
+    TRITONSERVER_TraceBuffer* trace_buffer);
+
+/// Consume records from a trace buffer. Copies up to
+/// 'buffer_byte_size' bytes of whole records into 'buffer' and
+/// returns the number of bytes copied, which is zero if no records
+/// are available. This function must be called from a single consumer
+/// thread at a time.
+///
+/// \param trace_buffer The trace buffer object.
+/// \param buffer The buffer into which the records are copied.
+/// \param buffer_byte_size The size, in bytes, of 'buffer'.
+/// \param consumed_byte_size Returns the number of bytes copied, a
+/// multiple of the record size.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_TraceBufferConsume(
+    TRITONSERVER_TraceBuffer* trace_buffer, void* buffer,
+    const uint64_t buffer_byte_size, uint64_t* consumed_byte_size);
+
+/// Create a new inference trace object that records activity into a
+/// trace buffer instead of delivering it by callback. Activity for
+/// 'trace' and for any child traces spawned by 'trace' is written to
+/// 'trace_buffer' as described for TRITONSERVER_TraceBuffer. The
+/// release callback behaves as described for
+/// TRITONSERVER_InferenceTraceNew.
+///
+/// \param trace Returns the new inference trace object.
+/// \param level The tracing level.
+/// \param parent_id The parent trace id for this trace. A value of 0
+/// indicates that there is not parent trace.
+/// \param trace_buffer The trace buffer that receives activity
+/// records. The buffer must outlive the trace.
+/// \param release_fn The callback function called when all activity
+/// is complete for the trace.
+/// \param trace_userp User-provided pointer that is delivered to
+/// the release callback function.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_InferenceTraceBufferNew(
+    TRITONSERVER_InferenceTrace** trace, TRITONSERVER_InferenceTraceLevel level,
+    uint64_t parent_id, TRITONSERVER_TraceBuffer* trace_buffer,
+    TRITONSERVER_InferenceTraceReleaseFn_t release_fn, void* trace_userp);
+
+/// TRITONSERVER_BufferRegistration
+///
+/// Object representing a long-lived memory region that has been
+/// registered with the server. Registering a region once allows the
+/// server to prepare it for zero-copy use: input data appended from a
+/// registered region is handed directly to
+/// TRITONBACKEND_InputBuffer consumers without an intermediate copy
+/// through the pinned-memory pool configured by
+/// TRITONSERVER_ServerOptionsSetPinnedMemoryPoolByteSize. Typical use
+/// is a shared-memory arena or CUDA allocation that holds input data
+/// for many requests.
+///
+
+/// Register a memory region with the server. The caller retains
+/// ownership of the region and must keep it valid and unmodified
+/// while any inference request referencing it is executing, until the
+/// region is unregistered with TRITONSERVER_ServerUnregisterBuffer.
+///
+/// \param server The inference server object.
+/// \param registration Returns the new buffer registration object.
+/// \param base The base address of the region.
+/// \param byte_size The size, in bytes, of the region.
+/// \param memory_type The memory type of the region.
+/// \param memory_type_id The memory type id of the region.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerRegisterBuffer(
+    TRITONSERVER_Server* server,
+    TRITONSERVER_BufferRegistration** registration, const void* base,
+    size_t byte_size, TRITONSERVER_MemoryType memory_type,
+    int64_t memory_type_id);
+
+/// Unregister a previously registered memory region and delete the
+/// registration object. The region must not be referenced by any
+/// in-flight inference request when it is unregistered.
+///
+/// \param server The inference server object.
+/// \param registration The buffer registration object.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerUnregisterBuffer(
+    TRITONSERVER_Server* server, TRITONSERVER_BufferRegistration* registration);
+
+/// TRITONSERVER_CompletionQueue
+///
+/// Object representing a queue of completed inference responses. A
+/// completion queue is an alternative to the per-request response
+/// callback set by TRITONSERVER_InferenceRequestSetResponseCallback:
+/// a request is associated with a queue at submit time using
+/// TRITONSERVER_InferenceRequestSetResponseQueue and responses
+/// produced for the request are enqueued to the queue instead of
+/// being delivered by callback. A frontend thread then drains
+/// completed responses in batches, replacing one cross-thread wakeup
+/// and indirect call per response with one wakeup per batch.
+///
+
+/// Create a new completion queue object. The caller takes ownership
+/// of the TRITONSERVER_CompletionQueue object and must call
+/// TRITONSERVER_CompletionQueueDelete to release the object. A queue
+/// may be shared by any number of inference requests.
+///
+/// \param queue Returns the new completion queue object.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_CompletionQueueNew(
+    TRITONSERVER_CompletionQueue** queue);
+
+/// Delete a completion queue object. The queue must not be deleted
+/// while any request associated with the queue is still executing,
+/// and any responses remaining in the queue are deleted.
+///
+/// \param queue The completion queue object.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_CompletionQueueDelete(
+    TRITONSERVER_CompletionQueue* queue);
+
+/// Dequeue up to 'max_response_count' completed responses from a
+/// completion queue. If the queue is empty the call blocks until at
+/// least one response is available or until 'timeout_us' microseconds
+/// have elapsed. A 'timeout_us' of 0 makes the call non-blocking so
+/// that it returns immediately with whatever responses are available,
+/// possibly none. The caller takes ownership of each returned
+/// response object and must call TRITONSERVER_InferenceResponseDelete
+/// to release it.
+///
+/// \param queue The completion queue object.
+/// \param timeout_us The maximum time to block waiting for a
+/// response, in microseconds. Use 0 to return immediately.
+/// \param max_response_count The capacity of the 'responses', 'flags'
+/// and 'userps' arrays.
+/// \param responses Array updated with the dequeued response
+/// objects. An entry may be nullptr as described for
+/// TRITONSERVER_InferenceResponseCompleteFn_t.
+/// \param flags Array updated with the completion flags for each
+/// dequeued response. \see TRITONSERVER_ResponseCompleteFlag.
+/// \param userps Array updated with the 'response_userp' value
+/// registered by TRITONSERVER_InferenceRequestSetResponseQueue for
+/// the request that produced each dequeued response.
+/// \param response_count Returns the number of responses dequeued.
+/// \return a TRITONSERVER_Error indicating success or failure. A
+/// timeout with no available response is not an error and is
+/// indicated by a 'response_count' of zero.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_CompletionQueueDequeue(
+    TRITONSERVER_CompletionQueue* queue, const uint64_t timeout_us,
+    const uint32_t max_response_count, TRITONSERVER_InferenceResponse** responses,
+    uint32_t* flags, void** userps, uint32_t* response_count);
+
 /// TRITONSERVER_InferenceRequest
 ///
 /// Object representing an inference request. The inference request
@@ -868,6 +1412,26 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_InferenceRequestAddInput(
     const TRITONSERVER_DataType datatype, const int64_t* shape,
     uint64_t dim_count);
 
+/// Set the buffer layout of a TRITONSERVER_TYPE_BYTES input
+/// previously added to a request with
+/// TRITONSERVER_InferenceRequestAddInput. Default is
+/// TRITONSERVER_BYTES_LAYOUT_INLINE. For
+/// TRITONSERVER_BYTES_LAYOUT_OFFSETS the data for the input must be
+/// assigned as exactly two buffers: the first holding the offsets
+/// region and the second holding the data region, as described by
+/// TRITONSERVER_BytesLayout. An error with code
+/// TRITONSERVER_ERROR_INVALID_ARG is returned if the input's datatype
+/// is not TRITONSERVER_TYPE_BYTES.
+///
+/// \param inference_request The request object.
+/// \param name The name of the input.
+/// \param layout The buffer layout of the input data.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetInputBytesLayout(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name,
+    const TRITONSERVER_BytesLayout layout);
+
 /// Remove an input from a request.
 ///
 /// \param inference_request The request object.
@@ -905,6 +1469,52 @@ TRITONSERVER_InferenceRequestAppendInputData(
     const void* base, size_t byte_size, TRITONSERVER_MemoryType memory_type,
     int64_t memory_type_id);
 
+/// Assign a buffer of data to an input with the buffer described by a
+/// buffer attributes object. This is equivalent to
+/// TRITONSERVER_InferenceRequestAppendInputData except that the
+/// memory type, memory type id, byte size and, for a GPU buffer from
+/// another process, the CUDA IPC handle are taken from
+/// 'buffer_attributes'. When a CUDA IPC handle is set the server
+/// opens the handle and uses the shared buffer directly instead of
+/// copying the data across the process boundary. The request does not
+/// take ownership of 'buffer_attributes', which must remain valid and
+/// unmodified until ownership of the request is returned via the
+/// release callback.
+///
+/// \param inference_request The request object.
+/// \param name The name of the input.
+/// \param base The base address of the input data.
+/// \param buffer_attributes The buffer attributes of the input data.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestAppendInputDataWithBufferAttributes(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name,
+    const void* base, TRITONSERVER_BufferAttributes* buffer_attributes);
+
+/// Assign a range of a registered buffer as data for an input. This
+/// is equivalent to TRITONSERVER_InferenceRequestAppendInputData with
+/// the base address and memory type taken from 'registration', except
+/// that the data is eligible for zero-copy handoff to the backend as
+/// described for TRITONSERVER_BufferRegistration and the registered
+/// region remains owned by the caller. The region must not be
+/// unregistered or modified until ownership of the request is
+/// returned via the release callback.
+///
+/// \param inference_request The request object.
+/// \param name The name of the input.
+/// \param registration The buffer registration object for the region
+/// holding the input data.
+/// \param offset The offset, in bytes, of the input data within the
+/// registered region.
+/// \param byte_size The size, in bytes, of the input data. 'offset' +
+/// 'byte_size' must not exceed the registered region.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestAppendInputDataRegistered(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name,
+    TRITONSERVER_BufferRegistration* registration, size_t offset,
+    size_t byte_size);
+
 /// Clear all input data from an input, releasing ownership of the
 /// buffer(s) that were appended to the input with
 /// TRITONSERVER_InferenceRequestAppendInputData.
@@ -981,6 +1591,107 @@ TRITONSERVER_InferenceRequestSetResponseCallback(
     TRITONSERVER_InferenceResponseCompleteFn_t response_fn,
     void* response_userp);
 
+/// Set the allocator and completion queue for an inference
+/// request. This is an alternative to
+/// TRITONSERVER_InferenceRequestSetResponseCallback: responses
+/// produced for this request are enqueued to 'queue' and retrieved
+/// with TRITONSERVER_CompletionQueueDequeue instead of being
+/// delivered by callback. A request must use either a response
+/// callback or a completion queue, not both; setting one replaces the
+/// other.
+///
+/// \param inference_request The request object.
+/// \param response_allocator The TRITONSERVER_ResponseAllocator to use
+/// to allocate buffers to hold inference results.
+/// \param response_allocator_userp User-provided pointer that is
+/// delivered to the response allocator's start and allocation functions.
+/// \param queue The completion queue that receives responses produced
+/// for this request. The queue must outlive the execution of the
+/// request.
+/// \param response_userp User-provided pointer that is returned by
+/// TRITONSERVER_CompletionQueueDequeue with each response produced
+/// for this request.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetResponseQueue(
+    TRITONSERVER_InferenceRequest* inference_request,
+    TRITONSERVER_ResponseAllocator* response_allocator,
+    void* response_allocator_userp, TRITONSERVER_CompletionQueue* queue,
+    void* response_userp);
+
+/// TRITONSERVER_InferenceRequestPool
+///
+/// Object representing a pool of inference request objects for a
+/// given model and version. Acquiring a request from a pool avoids
+/// the per-request allocation performed by
+/// TRITONSERVER_InferenceRequestNew, which can be significant on the
+/// inference hot path. A request released back to the pool is reset
+/// so that it can be acquired again: the request ID, flags,
+/// correlation ID, inputs, input data and requested outputs are
+/// cleared but the pool retains the interned input names so that a
+/// subsequent TRITONSERVER_InferenceRequestAddInput with a previously
+/// seen name does not need to re-hash or copy the name.
+///
+
+/// Create a new inference request pool object. The caller takes
+/// ownership of the TRITONSERVER_InferenceRequestPool object and must
+/// call TRITONSERVER_InferenceRequestPoolDelete to release the
+/// object. All requests acquired from the pool must be released back
+/// to the pool before the pool is deleted.
+///
+/// \param pool Returns the new inference request pool object.
+/// \param server the inference server object.
+/// \param model_name The name of the model that requests acquired
+/// from the pool will use.
+/// \param model_version The version of the model that requests
+/// acquired from the pool will use. If -1 then the server will choose
+/// a version based on the model's policy.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_InferenceRequestPoolNew(
+    TRITONSERVER_InferenceRequestPool** pool, TRITONSERVER_Server* server,
+    const char* model_name, const int64_t model_version);
+
+/// Delete an inference request pool object and all request objects
+/// currently held by the pool.
+///
+/// \param pool The inference request pool object.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestPoolDelete(TRITONSERVER_InferenceRequestPool* pool);
+
+/// Acquire an inference request from a pool. If the pool holds a
+/// previously released request that request is reset and returned
+/// without allocation, otherwise a new request object is
+/// allocated. The returned request behaves exactly as a request
+/// created with TRITONSERVER_InferenceRequestNew except that it must
+/// be returned to the pool with
+/// TRITONSERVER_InferenceRequestPoolRelease instead of being deleted
+/// with TRITONSERVER_InferenceRequestDelete. Typically the release is
+/// performed in the callback registered with
+/// TRITONSERVER_InferenceRequestSetReleaseCallback.
+///
+/// \param pool The inference request pool object.
+/// \param inference_request Returns the acquired request object.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestPoolAcquire(
+    TRITONSERVER_InferenceRequestPool* pool,
+    TRITONSERVER_InferenceRequest** inference_request);
+
+/// Release an inference request back to the pool it was acquired
+/// from. The request is reset as described for
+/// TRITONSERVER_InferenceRequestPool and becomes available for a
+/// subsequent TRITONSERVER_InferenceRequestPoolAcquire. The caller
+/// must not access 'inference_request' in any way after this call.
+///
+/// \param pool The inference request pool object.
+/// \param inference_request The request object to release.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestPoolRelease(
+    TRITONSERVER_InferenceRequestPool* pool,
+    TRITONSERVER_InferenceRequest* inference_request);
+
 /// TRITONSERVER_InferenceResponse
 ///
 /// Object representing an inference response. The inference response
@@ -1116,6 +1827,28 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_InferenceResponseOutput(
     TRITONSERVER_MemoryType* memory_type, int64_t* memory_type_id,
     void** userp);
 
+/// Get the buffer attributes of an output tensor of a response. The
+/// returned buffer attributes object is owned by the response and
+/// must not be modified or deleted by the caller; its lifetime
+/// extends until 'inference_response' is deleted. For an output in
+/// TRITONSERVER_MEMORY_GPU memory the attributes carry the CUDA IPC
+/// handle of the buffer and, when the data is still being produced on
+/// a stream, the IPC event to wait on before reading, so a co-located
+/// process can open the output buffer directly instead of receiving a
+/// copy.
+///
+/// \param inference_response The response object.
+/// \param index The index of the output tensor, must be 0 <= index <
+/// count, where 'count' is the value returned by
+/// TRITONSERVER_InferenceResponseOutputCount.
+/// \param buffer_attributes Returns the buffer attributes of the
+/// output tensor.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceResponseOutputBufferAttributes(
+    TRITONSERVER_InferenceResponse* inference_response, const uint32_t index,
+    TRITONSERVER_BufferAttributes** buffer_attributes);
+
 /// Get a classification label associated with an output for a given
 /// index.  The caller does not own the returned label and must not
 /// modify or delete it. The lifetime of all returned label extends
@@ -1144,9 +1877,16 @@ TRITONSERVER_InferenceResponseOutputClassificationLabel(
 typedef enum tritonserver_modelcontrolmode_enum {
   TRITONSERVER_MODEL_CONTROL_NONE,
   TRITONSERVER_MODEL_CONTROL_POLL,
-  TRITONSERVER_MODEL_CONTROL_EXPLICIT
+  TRITONSERVER_MODEL_CONTROL_EXPLICIT,
+  TRITONSERVER_MODEL_CONTROL_WATCH
 } TRITONSERVER_ModelControlMode;
 
+/// Rate limit modes
+typedef enum tritonserver_ratelimitmode_enum {
+  TRITONSERVER_RATE_LIMIT_OFF,
+  TRITONSERVER_RATE_LIMIT_EXEC_COUNT
+} TRITONSERVER_RateLimitMode;
+
 /// Create a new server options object. The caller takes ownership of
 /// the TRITONSERVER_ServerOptions object and must call
 /// TRITONSERVER_ServerOptionsDelete to release the object.
@@ -1185,6 +1925,28 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error*
 TRITONSERVER_ServerOptionsSetModelRepositoryPath(
     TRITONSERVER_ServerOptions* options, const char* model_repository_path);
 
+/// Set the path to the model repository manifest in a server options.
+/// The manifest is a file, maintained by Triton, that records a
+/// content digest for every model directory seen during a repository
+/// scan. When a manifest path is set, each scan first compares the
+/// recorded digests against the repository and skips stat-ing the
+/// contents of any model directory whose digest is unchanged, and the
+/// manifest is rewritten after the scan completes. This applies to
+/// the startup scan performed by TRITONSERVER_ServerNew as well as to
+/// rescans triggered by TRITONSERVER_ServerPollModelRepository or
+/// filesystem-watch notifications, and can reduce a rescan of a large
+/// repository from a full-tree metadata walk to a handful of reads.
+/// A missing or corrupt manifest is ignored and simply rebuilt by the
+/// next scan.
+///
+/// \param options The server options object.
+/// \param manifest_path The full path to the manifest file. The
+/// directory containing the file must be writable by the server.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelRepositoryManifestPath(
+    TRITONSERVER_ServerOptions* options, const char* manifest_path);
+
 /// Set the model control mode in a server options. For each mode the models
 /// will be managed as the following:
 ///
@@ -1202,6 +1964,15 @@ TRITONSERVER_ServerOptionsSetModelRepositoryPath(
 ///   not be loaded on startup. The corresponding model control APIs must be
 ///   called to load / unload a model in the model repository.
 ///
+///   TRITONSERVER_MODEL_CONTROL_WATCH: the models in model repository will be
+///   loaded on startup and the server will subscribe to filesystem change
+///   notifications (for example, inotify) for the repository, rescanning only
+///   the model directories reported as changed instead of the entire tree. On
+///   filesystems that do not deliver change notifications (for example, many
+///   network filesystems) the server falls back to the same full-tree scan as
+///   TRITONSERVER_MODEL_CONTROL_POLL. Calling
+///   TRITONSERVER_ServerPollModelRepository forces a full rescan in this mode.
+///
 /// \param options The server options object.
 /// \param mode The mode to use for the model control.
 /// \return a TRITONSERVER_Error indicating success or failure.
@@ -1233,6 +2004,48 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error*
 TRITONSERVER_ServerOptionsSetStrictModelConfig(
     TRITONSERVER_ServerOptions* options, bool strict);
 
+/// Set the rate limit mode in a server options.
+///
+///   TRITONSERVER_RATE_LIMIT_EXEC_COUNT: The rate limiting is applied
+///   to the model instances based on the number of times each
+///   instance has executed, as well as the resource demands declared
+///   for each instance in the model configuration. A request is
+///   dispatched to an instance only when the resources it demands can
+///   be granted from the per-device and global resource pools
+///   configured with TRITONSERVER_ServerOptionsAddRateLimiterResource;
+///   TRITONSERVER_InferenceRequestSetPriority breaks ties between
+///   requests waiting on the same resources.
+///
+///   TRITONSERVER_RATE_LIMIT_OFF: The rate limiting is turned off and
+///   requests are dispatched to any ready model instance with no
+///   regard for resource contention. Default.
+///
+/// \param options The server options object.
+/// \param mode The mode to use for the rate limiting.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetRateLimiterMode(
+    TRITONSERVER_ServerOptions* options, TRITONSERVER_RateLimitMode mode);
+
+/// Add resource count for rate limiting. A resource is an abstract
+/// quantity (for example, SM occupancy or memory bandwidth share of a
+/// device) that model instances declare demands against in their
+/// model configuration; the rate limiter grants an instance an
+/// execution slot only when all of its demanded resources are
+/// available.
+///
+/// \param options The server options object.
+/// \param resource_name The name of the resource.
+/// \param resource_count The count of the resource.
+/// \param device The device identifier for the resource. A value of
+/// -1 indicates that the resource is available globally on the
+/// server, otherwise the resource is limited to the specified device.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsAddRateLimiterResource(
+    TRITONSERVER_ServerOptions* options, const char* resource_name,
+    const size_t resource_count, const int device);
+
 /// Set the total pinned memory byte size that the server can allocate
 /// in a server options. The pinned memory pool will be shared across
 /// Triton itself and the backends that use
@@ -1306,6 +2119,111 @@ TRITONSERVER_Error*
 TRITONSERVER_ServerOptionsSetBufferManagerThreadCount(
     TRITONSERVER_ServerOptions* options, unsigned int thread_count);
 
+/// Set a host policy setting for a given policy name in a server
+/// options. A host policy binds a named group of model instances,
+/// their input staging buffers and the copy threads that gather their
+/// inputs to a processor and memory domain. Model instances are
+/// associated with a policy name in the model configuration; requests
+/// executing on an instance have their input gather routed to the
+/// copy threads local to that instance's domain. The recognized
+/// settings are:
+///
+///   "numa-node": The NUMA node that the instances and their staging
+///   buffers are bound to. The value is a node id, for example "0".
+///
+///   "cpu-cores": The CPU cores that the instance threads and copy
+///   threads may run on. The value is a range list, for example
+///   "0-15,32-47".
+///
+///   "memory-bind": Whether memory allocated for the instances is
+///   bound to the policy's NUMA node ("true") or only preferred there
+///   ("false"). Default is "true" when "numa-node" is set.
+///
+/// \param options The server options object.
+/// \param policy_name The name of the policy the setting applies to.
+/// \param setting The name of the setting.
+/// \param value The setting value.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetHostPolicy(
+    TRITONSERVER_ServerOptions* options, const char* policy_name,
+    const char* setting, const char* value);
+
+/// Set the number of threads used to concurrently load models in a
+/// server options. Models without dependencies on each other are
+/// loaded in parallel, both for the models loaded during
+/// TRITONSERVER_ServerNew and for concurrent
+/// TRITONSERVER_ServerLoadModel calls issued under
+/// TRITONSERVER_MODEL_CONTROL_EXPLICIT mode. Models composing an
+/// ensemble are loaded before the ensemble itself. The server becomes
+/// ready, as reported by TRITONSERVER_ServerIsReady, once the last
+/// parallel load completes. Default is 1, which loads models
+/// sequentially.
+///
+/// \param options The server options object.
+/// \param thread_count The number of model load threads.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelLoadThreadCount(
+    TRITONSERVER_ServerOptions* options, unsigned int thread_count);
+
+/// Enable or disable memory-mapped model loading in a server
+/// options. When enabled, the artifacts in a model's version
+/// directory are mapped read-only with a sequential prefetch hint
+/// instead of being read into private heap copies, for backends that
+/// declare support with TRITONBACKEND_ModelSetMemoryMappedArtifacts.
+/// The mappings are exposed to the backend by
+/// TRITONBACKEND_ModelArtifactMemoryMap and are shared across all
+/// instances of the model, so multiple CPU instances reference a
+/// single physical copy of the weights. Backends that do not declare
+/// support continue to load artifacts through normal file I/O.
+///
+/// \param options The server options object.
+/// \param memory_map True to enable memory-mapped model loading,
+/// false to disable.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelLoadMemoryMapping(
+    TRITONSERVER_ServerOptions* options, bool memory_map);
+
+/// Enable or disable model warmup in a server options. When enabled,
+/// the warmup specs in a model's configuration are executed on every
+/// instance of the model through the normal
+/// TRITONBACKEND_ModelInstanceExecute path after the model loads and
+/// before TRITONSERVER_ServerModelIsReady reports the model as ready,
+/// so one-time costs such as lazy device context creation, allocator
+/// growth and kernel autotuning are not paid by the first served
+/// requests. A warmup spec describes the inputs to use: synthetic
+/// zero or random data generated from the configured shapes and
+/// datatypes, or replay of a recorded request sample file (see
+/// TRITONSERVER_ServerOptionsSetModelWarmupSampleDirectory). Warmup
+/// executions are excluded from the statistics reported by
+/// TRITONSERVER_ServerModelStatistics and from those recorded by
+/// TRITONBACKEND_ModelInstanceReportStatistics. Default is false.
+///
+/// \param options The server options object.
+/// \param warmup True to enable model warmup, false to disable.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelWarmup(
+    TRITONSERVER_ServerOptions* options, bool warmup);
+
+/// Set the directory holding recorded request sample files for model
+/// warmup in a server options. A warmup spec in a model's
+/// configuration can reference a sample file by name in place of
+/// synthetic input data; the file holds the serialized inputs of a
+/// previously captured request and is read from this directory. An
+/// error with code TRITONSERVER_ERROR_NOT_FOUND is raised at model
+/// load if a referenced sample file does not exist.
+///
+/// \param options The server options object.
+/// \param sample_directory The full path to the directory holding the
+/// sample files.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelWarmupSampleDirectory(
+    TRITONSERVER_ServerOptions* options, const char* sample_directory);
+
 /// Enable or disable info level logging.
 ///
 /// \param options The server options object.
@@ -1396,6 +2314,122 @@ TRITONSERVER_ServerOptionsSetBackendConfig(
     TRITONSERVER_ServerOptions* options, const char* backend_name,
     const char* setting, const char* value);
 
+/// TRITONSERVER_DeadlinePolicy
+///
+/// Policies for handling a queued request whose timeout, as set by
+/// TRITONSERVER_InferenceRequestSetTimeoutMicroseconds, has expired
+/// or cannot be met.
+///
+///   TRITONSERVER_DEADLINE_POLICY_IGNORE: Request timeouts are not
+///     enforced by the scheduler queues. This is the default.
+///
+///   TRITONSERVER_DEADLINE_POLICY_REJECT_EXPIRED: A request whose
+///     timeout has expired while queued is rejected when it is
+///     dequeued, with a response error of code
+///     TRITONSERVER_ERROR_DEADLINE_EXCEEDED, instead of being
+///     executed.
+///
+///   TRITONSERVER_DEADLINE_POLICY_SHED_EARLY: In addition to the
+///     behavior of TRITONSERVER_DEADLINE_POLICY_REJECT_EXPIRED, a
+///     request is rejected at enqueue time, with a response error of
+///     code TRITONSERVER_ERROR_DEADLINE_EXCEEDED, if the estimated
+///     queue wait, based on the queue depth and the model's recent
+///     compute durations, already exceeds the request's timeout.
+///     Shedding at enqueue returns the error before any input
+///     processing is performed for the request.
+///
+/// Under both enforcing policies, requests of equal priority are
+/// dequeued in earliest-deadline-first order, so a request with
+/// little remaining budget is not starved behind earlier arrivals
+/// with looser deadlines. Requests that do not set a timeout order
+/// after all deadline-bearing requests of the same priority.
+///
+typedef enum tritonserver_deadlinepolicy_enum {
+  TRITONSERVER_DEADLINE_POLICY_IGNORE,
+  TRITONSERVER_DEADLINE_POLICY_REJECT_EXPIRED,
+  TRITONSERVER_DEADLINE_POLICY_SHED_EARLY
+} TRITONSERVER_DeadlinePolicy;
+
+/// Set the deadline policy applied by the scheduler queues in a
+/// server options. The policy applies to every model served by the
+/// server; requests that do not set a timeout are never rejected.
+///
+/// \param options The server options object.
+/// \param policy The deadline policy.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetDeadlinePolicy(
+    TRITONSERVER_ServerOptions* options, TRITONSERVER_DeadlinePolicy policy);
+
+/// Set the configuration for a named response cache in a server
+/// options. The response cache stores the output tensors of completed
+/// inference responses keyed by a hash of the request inputs; a
+/// subsequent identical request is answered from the cache, bypassing
+/// scheduling and TRITONBACKEND_ModelInstanceExecute entirely. Cache
+/// hit counts are reported by TRITONSERVER_ServerModelStatistics. The
+/// built-in cache is named 'local' and accepts a configuration of the
+/// form {"size": <byte size>}; other names refer to a cache
+/// implementation loaded as a shared library implementing the API
+/// defined in tritoncache.h. If no cache configuration is set the
+/// response cache is disabled.
+///
+/// \param options The server options object.
+/// \param cache_name The name of the cache.
+/// \param config The serialized JSON configuration for the cache.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetCacheConfig(
+    TRITONSERVER_ServerOptions* options, const char* cache_name,
+    const char* config);
+
+/// Add a pipeline to a server options. A pipeline is a composed model
+/// made of a sequence of stages, each an existing model in the model
+/// repository, with the outputs of one stage wired to the inputs of
+/// the next. The pipeline is exposed under 'pipeline_name' like any
+/// other model: it is inferred with a single
+/// TRITONSERVER_ServerInferAsync call, appears in the model index and
+/// reports statistics.
+///
+/// The scheduler executes the stages by handing each intermediate
+/// tensor's buffer, as produced by the upstream stage's
+/// TRITONBACKEND_OutputBuffer, directly to the downstream stage's
+/// TRITONBACKEND_InputBuffer. When consecutive stages execute on the
+/// same device an intermediate tensor never leaves that device and is
+/// never materialized through the request's response allocator; only
+/// the final stage's outputs cross the allocator. Intermediate
+/// buffers are released once the consuming stage completes.
+///
+/// The pipeline configuration is a serialized JSON object of the
+/// form:
+///
+///   {
+///     "stages" : [
+///       {
+///         "model_name" : <string>,
+///         "model_version" : <int64>,
+///         "input_map" : { <stage input name> : <tensor name>, ... },
+///         "output_map" : { <stage output name> : <tensor name>, ... }
+///       },
+///       ...
+///     ]
+///   }
+///
+/// where tensor names not produced by an earlier stage refer to the
+/// pipeline's own inputs and tensor names mapped by the final
+/// "output_map" entries name the pipeline's outputs. An error with
+/// code TRITONSERVER_ERROR_INVALID_ARG is raised at server creation
+/// if the wiring references an unknown tensor or model.
+///
+/// \param options The server options object.
+/// \param pipeline_name The name the pipeline is served under.
+/// \param pipeline_config The serialized JSON configuration for the
+/// pipeline.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsAddPipeline(
+    TRITONSERVER_ServerOptions* options, const char* pipeline_name,
+    const char* pipeline_config);
+
 /// TRITONSERVER_Server
 ///
 /// An inference server.
@@ -1574,6 +2608,52 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerModelStatistics(
     TRITONSERVER_Server* server, const char* model_name,
     const int64_t model_version, TRITONSERVER_Message** model_stats);
 
+/// Get the statistics of a model as a versioned packed binary record
+/// written into a caller-provided buffer. This is a cheap alternative
+/// to TRITONSERVER_ServerModelStatistics for pollers that read the
+/// statistics frequently: no message object is created and no JSON is
+/// serialized.
+///
+/// The record layout, with all fields little-endian and no padding,
+/// is:
+///
+///   uint32_t format_version;     currently 1
+///   uint32_t batch_stats_count;  number of batch entries that follow
+///                                the fixed fields
+///   uint64_t success_count;      successful inference requests
+///   uint64_t fail_count;         failed inference requests
+///   uint64_t queue_duration_ns;  cumulative time spent in queue
+///   uint64_t compute_input_duration_ns;
+///   uint64_t compute_infer_duration_ns;
+///   uint64_t compute_output_duration_ns;
+///
+/// followed by 'batch_stats_count' entries of:
+///
+///   uint64_t batch_size;
+///   uint64_t count;              executions with this batch size
+///   uint64_t compute_infer_duration_ns;
+///
+/// All counters are cumulative since the model was loaded. Fields
+/// will only be appended within format version 1; any change to the
+/// existing fields increases 'format_version'.
+///
+/// \param server The inference server object.
+/// \param model_name The name of the model.
+/// \param model_version The version of the model. If -1 then the
+/// server will choose a version based on the model's policy.
+/// \param buffer The buffer into which the record is written.
+/// \param buffer_byte_size The size, in bytes, of 'buffer'.
+/// \param record_byte_size Returns the size, in bytes, of the
+/// record. If this is larger than 'buffer_byte_size' an error with
+/// code TRITONSERVER_ERROR_INVALID_ARG is returned and the caller
+/// should retry with a buffer of at least the returned size.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerModelStatisticsBinary(
+    TRITONSERVER_Server* server, const char* model_name,
+    const int64_t model_version, void* buffer, size_t buffer_byte_size,
+    size_t* record_byte_size);
+
 /// Get the configuration of a model as a TRITONSERVER_Message object.
 /// The caller takes ownership of the message object and must call
 /// TRITONSERVER_MessageDelete to release the object.
@@ -1612,6 +2692,49 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerModelIndex(
     TRITONSERVER_Server* server, uint32_t flags,
     TRITONSERVER_Message** model_index);
 
+/// Get a page of the index of unique models in the model
+/// repositories as a TRITONSERVER_Message object. The caller takes
+/// ownership of the message object and must call
+/// TRITONSERVER_MessageDelete to release the object.
+///
+/// Unlike TRITONSERVER_ServerModelIndex, which serializes the entire
+/// repository state on every call, this function reads from an index
+/// that the server maintains incrementally as models are loaded and
+/// unloaded. Every change to the index is assigned a monotonically
+/// increasing sequence number; a caller that remembers the
+/// 'index_sequence' returned by its previous call can pass it as
+/// 'changed_since' to receive only the entries that changed after
+/// that point, making repeated polling O(changes) instead of O(models).
+///
+/// If TRITONSERVER_INDEX_FLAG_READY is set in 'flags' only the models
+/// that are loaded into the server and ready for inferencing are
+/// returned.
+///
+/// \param server The inference server object.
+/// \param flags TRITONSERVER_ModelIndexFlag flags that control how to
+/// collect the index.
+/// \param offset The number of matching entries to skip before the
+/// returned page.
+/// \param limit The maximum number of entries to return. Zero
+/// indicates no limit.
+/// \param changed_since Return only entries whose state changed after
+/// this sequence number. Zero returns all matching entries.
+/// \param model_index Return the model index message that holds the
+/// requested page of index entries.
+/// \param total_count Return the total number of entries matching
+/// 'flags' and 'changed_since', before 'offset' and 'limit' are
+/// applied.
+/// \param index_sequence Return the sequence number of the most
+/// recent index change, to be passed as 'changed_since' on a
+/// subsequent call.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerModelIndexPaginated(
+    TRITONSERVER_Server* server, uint32_t flags, const uint64_t offset,
+    const uint64_t limit, const uint64_t changed_since,
+    TRITONSERVER_Message** model_index, uint64_t* total_count,
+    uint64_t* index_sequence);
+
 /// Load the requested model or reload the model if it is already
 /// loaded. The function does not return until the model is loaded or
 /// fails to load. Returned error indicates if model loaded
@@ -1623,6 +2746,46 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerModelIndex(
 TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerLoadModel(
     TRITONSERVER_Server* server, const char* model_name);
 
+/// Get the number of execution instances of a model for a given
+/// instance-group kind.
+///
+/// \param server The inference server object.
+/// \param model_name The name of the model.
+/// \param model_version The version of the model. If -1 then the
+/// server will choose a version based on the model's policy.
+/// \param kind The instance-group kind to report the count for.
+/// \param count Returns the number of instances of the given kind
+/// across all devices.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerModelInstanceCount(
+    TRITONSERVER_Server* server, const char* model_name,
+    const int64_t model_version, const TRITONSERVER_InstanceGroupKind kind,
+    uint32_t* count);
+
+/// Set the number of execution instances of a loaded model for a
+/// given instance-group kind, without reloading the model. When the
+/// count increases, new instances are created and begin accepting
+/// work from the model's scheduler as each becomes ready; the model's
+/// state, and for backends that share weights across instances the
+/// weights themselves, are not reloaded. When the count decreases,
+/// removed instances stop receiving new work immediately and are
+/// destroyed once their in-flight requests complete; the function
+/// does not wait for that to happen. The instance count reverts to
+/// the model configuration if the model is reloaded.
+///
+/// \param server The inference server object.
+/// \param model_name The name of the model.
+/// \param model_version The version of the model. If -1 then the
+/// server will choose a version based on the model's policy.
+/// \param kind The instance-group kind to adjust.
+/// \param count The new number of instances of the given kind.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerModelSetInstanceCount(
+    TRITONSERVER_Server* server, const char* model_name,
+    const int64_t model_version, const TRITONSERVER_InstanceGroupKind kind,
+    const uint32_t count);
+
 /// Unload the requested model. Unloading a model that is not loaded
 /// on server has no affect and success code will be returned.
 /// The function does not wait for the requested model to be fully unload
@@ -1685,6 +2848,111 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerInferAsync(
     TRITONSERVER_InferenceRequest* inference_request,
     TRITONSERVER_InferenceTrace* trace);
 
+/// Perform inference for a batch of requests. This call is equivalent
+/// to calling TRITONSERVER_ServerInferAsync once for each entry of
+/// 'inference_requests' except that all requests destined for the
+/// same model are enqueued to that model's scheduler under a single
+/// lock acquisition and a single scheduler wakeup, amortizing the
+/// per-request queueing cost for bursty traffic.
+///
+/// The ownership semantics of TRITONSERVER_ServerInferAsync apply
+/// independently to each entry of 'inference_requests' and
+/// 'traces'. If the function returns an error, then ownership of all
+/// requests and traces remains with the caller and no request was
+/// enqueued. If the function returns success, ownership of every
+/// request and trace is released as described for
+/// TRITONSERVER_ServerInferAsync.
+///
+/// \param server The inference server object.
+/// \param inference_requests The request objects.
+/// \param request_count The number of requests in
+/// 'inference_requests'.
+/// \param traces The trace objects, one entry for each request, or
+/// nullptr if no tracing. An individual entry may be nullptr to
+/// indicate no tracing for the corresponding request.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerInferBatchAsync(
+    TRITONSERVER_Server* server,
+    TRITONSERVER_InferenceRequest** inference_requests,
+    const uint32_t request_count, TRITONSERVER_InferenceTrace** traces);
+
+/// TRITONSERVER_ApiTable
+///
+/// Table of function pointers for the per-request hot path of the
+/// API. Each member points at the implementation of the
+/// correspondingly named TRITONSERVER_* function and behaves
+/// identically to calling that function directly, but a caller that
+/// fetches the table once with TRITONSERVER_ApiTableGet and calls
+/// through it avoids the dynamic linker indirection paid by every
+/// direct call into the library.
+///
+/// The table only ever grows: new members are appended and existing
+/// members are never removed, reordered or changed in signature.
+/// 'struct_size' is filled by Triton with the byte size of the table
+/// it was built with, so a caller built against a newer version of
+/// this header can detect whether a member is present by comparing
+/// offsetof that member against 'struct_size' instead of probing
+/// individual symbols.
+///
+typedef struct TRITONSERVER_api_table_struct {
+  size_t struct_size;
+
+  TRITONSERVER_Error* (*InferenceRequestNew)(
+      TRITONSERVER_InferenceRequest** inference_request,
+      TRITONSERVER_Server* server, const char* model_name,
+      const int64_t model_version);
+  TRITONSERVER_Error* (*InferenceRequestDelete)(
+      TRITONSERVER_InferenceRequest* inference_request);
+  TRITONSERVER_Error* (*InferenceRequestAddInput)(
+      TRITONSERVER_InferenceRequest* inference_request, const char* name,
+      const TRITONSERVER_DataType datatype, const int64_t* shape,
+      uint64_t dim_count);
+  TRITONSERVER_Error* (*InferenceRequestAppendInputData)(
+      TRITONSERVER_InferenceRequest* inference_request, const char* name,
+      const void* base, size_t byte_size, TRITONSERVER_MemoryType memory_type,
+      int64_t memory_type_id);
+  TRITONSERVER_Error* (*InferenceRequestRemoveAllInputData)(
+      TRITONSERVER_InferenceRequest* inference_request, const char* name);
+  TRITONSERVER_Error* (*InferenceRequestAddRequestedOutput)(
+      TRITONSERVER_InferenceRequest* inference_request, const char* name);
+  TRITONSERVER_Error* (*InferenceRequestSetReleaseCallback)(
+      TRITONSERVER_InferenceRequest* inference_request,
+      TRITONSERVER_InferenceRequestReleaseFn_t request_release_fn,
+      void* request_release_userp);
+  TRITONSERVER_Error* (*InferenceRequestSetResponseCallback)(
+      TRITONSERVER_InferenceRequest* inference_request,
+      TRITONSERVER_ResponseAllocator* response_allocator,
+      void* response_allocator_userp,
+      TRITONSERVER_InferenceResponseCompleteFn_t response_fn,
+      void* response_userp);
+  TRITONSERVER_Error* (*ServerInferAsync)(
+      TRITONSERVER_Server* server,
+      TRITONSERVER_InferenceRequest* inference_request,
+      TRITONSERVER_InferenceTrace* trace);
+  TRITONSERVER_Error* (*InferenceResponseDelete)(
+      TRITONSERVER_InferenceResponse* inference_response);
+  TRITONSERVER_Error* (*InferenceResponseError)(
+      TRITONSERVER_InferenceResponse* inference_response);
+  TRITONSERVER_Error* (*InferenceResponseOutputCount)(
+      TRITONSERVER_InferenceResponse* inference_response, uint32_t* count);
+  TRITONSERVER_Error* (*InferenceResponseOutput)(
+      TRITONSERVER_InferenceResponse* inference_response, const uint32_t index,
+      const char** name, TRITONSERVER_DataType* datatype,
+      const int64_t** shape, uint64_t* dim_count, const void** base,
+      size_t* byte_size, TRITONSERVER_MemoryType* memory_type,
+      int64_t* memory_type_id, void** userp);
+} TRITONSERVER_ApiTable;
+
+/// Get the API function pointer table. The returned table is owned by
+/// Triton, is valid for the lifetime of the process and is the same
+/// table on every call, so a caller should fetch it once and cache
+/// it.
+///
+/// \param api_table Returns the API function pointer table.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ApiTableGet(
+    const TRITONSERVER_ApiTable** api_table);
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,191 @@
+// Copyright (c) 2021, NVIDIA CORPORATION. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Microbenchmarks for the per-request hot path of the Triton Server
+// API. The benchmark executable links against libtritonserver.so the
+// same way the stub target does, so when run against the stub library
+// built in this repo it measures only call/dispatch overhead; when the
+// library is replaced by the real core (the normal deployment layout)
+// it measures the full per-request cost of each call sequence. Return
+// values and output arguments are deliberately not inspected so that
+// the same binary runs against both libraries.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "triton/core/tritonserver.h"
+
+namespace {
+
+// Callbacks matching what a typical frontend installs on each
+// request. Against the stub they are never invoked by the library;
+// BM_ResponseAllocatorInvoke calls the allocation callback directly
+// to measure the frontend-side cost of one allocator crossing.
+TRITONSERVER_Error*
+ResponseAlloc(
+    TRITONSERVER_ResponseAllocator* allocator, const char* tensor_name,
+    size_t byte_size, TRITONSERVER_MemoryType memory_type,
+    int64_t memory_type_id, void* userp, void** buffer, void** buffer_userp,
+    TRITONSERVER_MemoryType* actual_memory_type,
+    int64_t* actual_memory_type_id)
+{
+  *buffer = userp;
+  *buffer_userp = nullptr;
+  *actual_memory_type = memory_type;
+  *actual_memory_type_id = memory_type_id;
+  return nullptr;  // Success
+}
+
+TRITONSERVER_Error*
+ResponseRelease(
+    TRITONSERVER_ResponseAllocator* allocator, void* buffer,
+    void* buffer_userp, size_t byte_size, TRITONSERVER_MemoryType memory_type,
+    int64_t memory_type_id)
+{
+  return nullptr;  // Success
+}
+
+void
+InferResponseComplete(
+    TRITONSERVER_InferenceResponse* response, const uint32_t flags,
+    void* userp)
+{
+}
+
+void
+InferRequestRelease(
+    TRITONSERVER_InferenceRequest* request, const uint32_t flags, void* userp)
+{
+}
+
+// Create / populate / delete cycle for an inference request: one
+// input with a single data buffer, as submitted by a minimal
+// frontend.
+void
+BM_InferenceRequestLifecycle(benchmark::State& state)
+{
+  const std::vector<int64_t> shape{1, 8};
+  const std::vector<uint8_t> data(32, 0);
+
+  for (auto _ : state) {
+    TRITONSERVER_InferenceRequest* request = nullptr;
+    TRITONSERVER_InferenceRequestNew(
+        &request, nullptr /* server */, "model", -1 /* model_version */);
+    TRITONSERVER_InferenceRequestAddInput(
+        request, "INPUT0", TRITONSERVER_TYPE_FP32, shape.data(), shape.size());
+    TRITONSERVER_InferenceRequestAppendInputData(
+        request, "INPUT0", data.data(), data.size(), TRITONSERVER_MEMORY_CPU,
+        0 /* memory_type_id */);
+    TRITONSERVER_InferenceRequestDelete(request);
+    benchmark::DoNotOptimize(request);
+  }
+}
+BENCHMARK(BM_InferenceRequestLifecycle);
+
+// Full submit round-trip: request setup, callback registration and
+// TRITONSERVER_ServerInferAsync. Against the real core this should be
+// run with a server holding a null/identity backend so the measured
+// time is scheduling and dispatch, not model execution.
+void
+BM_ServerInferAsync(benchmark::State& state)
+{
+  const std::vector<int64_t> shape{1, 8};
+  const std::vector<uint8_t> data(32, 0);
+
+  TRITONSERVER_ResponseAllocator* allocator = nullptr;
+  TRITONSERVER_ResponseAllocatorNew(
+      &allocator, ResponseAlloc, ResponseRelease, nullptr /* start_fn */);
+
+  for (auto _ : state) {
+    TRITONSERVER_InferenceRequest* request = nullptr;
+    TRITONSERVER_InferenceRequestNew(
+        &request, nullptr /* server */, "model", -1 /* model_version */);
+    TRITONSERVER_InferenceRequestSetReleaseCallback(
+        request, InferRequestRelease, nullptr /* request_release_userp */);
+    TRITONSERVER_InferenceRequestAddInput(
+        request, "INPUT0", TRITONSERVER_TYPE_FP32, shape.data(), shape.size());
+    TRITONSERVER_InferenceRequestAppendInputData(
+        request, "INPUT0", data.data(), data.size(), TRITONSERVER_MEMORY_CPU,
+        0 /* memory_type_id */);
+    TRITONSERVER_InferenceRequestSetResponseCallback(
+        request, allocator, nullptr /* response_allocator_userp */,
+        InferResponseComplete, nullptr /* response_userp */);
+    TRITONSERVER_ServerInferAsync(
+        nullptr /* server */, request, nullptr /* trace */);
+    TRITONSERVER_InferenceRequestDelete(request);
+    benchmark::DoNotOptimize(request);
+  }
+
+  TRITONSERVER_ResponseAllocatorDelete(allocator);
+}
+BENCHMARK(BM_ServerInferAsync);
+
+// One allocator crossing: the cost the core pays every time it needs
+// an output buffer from the frontend.
+void
+BM_ResponseAllocatorInvoke(benchmark::State& state)
+{
+  uint8_t backing[64];
+
+  for (auto _ : state) {
+    void* buffer = nullptr;
+    void* buffer_userp = nullptr;
+    TRITONSERVER_MemoryType actual_memory_type;
+    int64_t actual_memory_type_id;
+    ResponseAlloc(
+        nullptr /* allocator */, "OUTPUT0", sizeof(backing),
+        TRITONSERVER_MEMORY_CPU, 0 /* memory_type_id */, backing, &buffer,
+        &buffer_userp, &actual_memory_type, &actual_memory_type_id);
+    ResponseRelease(
+        nullptr /* allocator */, buffer, buffer_userp, sizeof(backing),
+        actual_memory_type, actual_memory_type_id);
+    benchmark::DoNotOptimize(buffer);
+  }
+}
+BENCHMARK(BM_ResponseAllocatorInvoke);
+
+// Metrics serialization as scraped by a monitoring endpoint.
+void
+BM_MetricsFormatted(benchmark::State& state)
+{
+  for (auto _ : state) {
+    TRITONSERVER_Metrics* metrics = nullptr;
+    TRITONSERVER_ServerMetrics(nullptr /* server */, &metrics);
+    const char* base = nullptr;
+    size_t byte_size = 0;
+    TRITONSERVER_MetricsFormatted(
+        metrics, TRITONSERVER_METRIC_PROMETHEUS, &base, &byte_size);
+    TRITONSERVER_MetricsDelete(metrics);
+    benchmark::DoNotOptimize(base);
+  }
+}
+BENCHMARK(BM_MetricsFormatted);
+
+}  // namespace
+
+BENCHMARK_MAIN();
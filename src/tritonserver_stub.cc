@@ -94,6 +94,10 @@ TRITONSERVER_ResponseAllocatorNew()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ResponseAllocatorSetQueryFunction()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ResponseAllocatorDelete()
 {
 }
@@ -118,6 +122,42 @@ TRITONSERVER_MetricsFormatted()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_MetricFamilyNew()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_MetricFamilyDelete()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_MetricNew()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_MetricDelete()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_MetricIncrement()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_MetricSet()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_MetricObserve()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_MetricSetHistogramBuckets()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_MetricValue()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_InferenceTraceLevelString()
 {
 }
@@ -150,6 +190,22 @@ TRITONSERVER_InferenceTraceModelVersion()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_TraceBufferNew()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_TraceBufferDelete()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_TraceBufferConsume()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceTraceBufferNew()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_InferenceRequestNew()
 {
 }
@@ -202,6 +258,10 @@ TRITONSERVER_InferenceRequestAddInput()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceRequestSetInputBytesLayout()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_InferenceRequestRemoveInput()
 {
 }
@@ -214,6 +274,70 @@ TRITONSERVER_InferenceRequestAppendInputData()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceRequestAppendInputDataRegistered()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceRequestAppendInputDataWithBufferAttributes()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_BufferAttributesNew()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_BufferAttributesDelete()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_BufferAttributesSetMemoryTypeId()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_BufferAttributesSetMemoryType()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_BufferAttributesSetCudaIpcHandle()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_BufferAttributesSetCudaIpcEventHandle()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_BufferAttributesSetByteSize()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_BufferAttributesMemoryTypeId()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_BufferAttributesMemoryType()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_BufferAttributesCudaIpcHandle()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_BufferAttributesCudaIpcEventHandle()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_BufferAttributesByteSize()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerRegisterBuffer()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerUnregisterBuffer()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_InferenceRequestRemoveAllInputData()
 {
 }
@@ -238,6 +362,38 @@ TRITONSERVER_InferenceRequestSetResponseCallback()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceRequestSetResponseQueue()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_CompletionQueueNew()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_CompletionQueueDelete()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_CompletionQueueDequeue()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceRequestPoolNew()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceRequestPoolDelete()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceRequestPoolAcquire()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceRequestPoolRelease()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_InferenceResponseDelete()
 {
 }
@@ -270,6 +426,10 @@ TRITONSERVER_InferenceResponseOutput()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceResponseOutputBufferAttributes()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_InferenceResponseOutputClassificationLabel()
 {
 }
@@ -290,10 +450,22 @@ TRITONSERVER_ServerOptionsSetModelRepositoryPath()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetModelRepositoryManifestPath()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerOptionsSetModelControlMode()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetRateLimiterMode()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsAddRateLimiterResource()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerOptionsSetStartupModel()
 {
 }
@@ -362,6 +534,38 @@ TRITONSERVER_ServerOptionsSetBackendConfig()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetCacheConfig()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsAddPipeline()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetHostPolicy()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetModelLoadThreadCount()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetModelLoadMemoryMapping()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetModelWarmup()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetModelWarmupSampleDirectory()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetDeadlinePolicy()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerNew()
 {
 }
@@ -410,6 +614,10 @@ TRITONSERVER_ServerModelStatistics()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerModelStatisticsBinary()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerModelConfig()
 {
 }
@@ -418,10 +626,22 @@ TRITONSERVER_ServerModelIndex()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerModelIndexPaginated()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerLoadModel()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerModelInstanceCount()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerModelSetInstanceCount()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerUnloadModel()
 {
 }
@@ -438,6 +658,14 @@ TRITONSERVER_ServerInferAsync()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerInferBatchAsync()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ApiTableGet()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_ApiVersion()
 {
 }
@@ -450,6 +678,18 @@ TRITONBACKEND_MemoryManagerFree()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_MemoryManagerAllocateAsync()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_MemoryManagerFreeAsync()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_MemoryManagerPoolStats()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_InputProperties()
 {
 }
@@ -458,10 +698,26 @@ TRITONBACKEND_InputBuffer()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_InputBufferAttributes()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_InputCollect()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_InputBytesLayout()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_OutputBuffer()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_OutputSetBytesLayout()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_RequestId()
 {
 }
@@ -498,6 +754,18 @@ TRITONBACKEND_RequestRelease()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_StateNew()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_StateBuffer()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_StateUpdate()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_ResponseFactoryNew()
 {
 }
@@ -510,6 +778,14 @@ TRITONBACKEND_ResponseFactorySendFlags()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_ResponseFactorySetMaxPendingResponses()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_ResponseFactoryPendingResponseCount()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_ResponseNew()
 {
 }
@@ -538,6 +814,10 @@ TRITONBACKEND_ResponseOutput()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_ResponseOutputsAllocate()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_ResponseSend()
 {
 }
@@ -598,6 +878,14 @@ TRITONBACKEND_ModelSetConfig()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_ModelSetMemoryMappedArtifacts()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_ModelArtifactMemoryMap()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_ModelServer()
 {
 }
@@ -626,6 +914,10 @@ TRITONBACKEND_ModelInstanceDeviceId()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_ModelInstanceHostPolicy()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_ModelInstanceIsPassive()
 {
 }
@@ -657,6 +949,26 @@ TRITONAPI_DECLSPEC void
 TRITONBACKEND_ModelInstanceReportBatchStatistics()
 {
 }
+TRITONAPI_DECLSPEC void
+TRITONCACHE_ApiVersion()
+{
+}
+
+TRITONAPI_DECLSPEC void
+TRITONCACHE_CacheEntryBufferCount()
+{
+}
+
+TRITONAPI_DECLSPEC void
+TRITONCACHE_CacheEntryBuffer()
+{
+}
+
+TRITONAPI_DECLSPEC void
+TRITONCACHE_CacheEntryAddBuffer()
+{
+}
+
 TRITONAPI_DECLSPEC void
 TRITONREPOAGENT_ApiVersion()
 {
@@ -671,6 +983,10 @@ TRITONAPI_DECLSPEC void
 TRITONREPOAGENT_ModelRepositoryLocationAcquire()
 {
 }
+TRITONAPI_DECLSPEC void
+TRITONREPOAGENT_ModelRepositoryLocationAcquireStreamed()
+{
+}
 
 TRITONAPI_DECLSPEC void
 TRITONREPOAGENT_ModelRepositoryLocationRelease()
@@ -681,6 +997,10 @@ TRITONAPI_DECLSPEC void
 TRITONREPOAGENT_ModelRepositoryUpdate()
 {
 }
+TRITONAPI_DECLSPEC void
+TRITONREPOAGENT_ModelRepositoryUpdateOverlay()
+{
+}
 
 TRITONAPI_DECLSPEC void
 TRITONREPOAGENT_ModelParameterCount()